@@ -3,7 +3,9 @@
 #include "ImGuiNotify.hpp"
 #include <implot.h>
 #include "imgui_internal.h"
+#include <coreobjects/property_internal_ptr.h>
 #include <cstdio>
+#include <algorithm>
 #include <sstream>
 
 
@@ -11,12 +13,68 @@ std::unordered_map<std::string, ImVec4> CachedComponent::signal_colors_;
 int CachedComponent::next_signal_color_index_ = 0;
 
 
+std::vector<std::future<std::unique_ptr<CachedComponent>>>* CachedComponent::abandoned_property_loads_ = nullptr;
+
+static void PruneAbandonedPropertyLoads()
+{
+    auto* loads = CachedComponent::abandoned_property_loads_;
+    if (!loads)
+        return;
+    loads->erase(std::remove_if(loads->begin(), loads->end(),
+                                [](const std::future<std::unique_ptr<CachedComponent>>& load)
+                                { return load.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+                 loads->end());
+}
+
+
 CachedComponent::CachedComponent(daq::ComponentPtr component)
     : component_(component)
 {
     UpdateState();
 }
 
+CachedComponent::CachedComponent(const CachedComponent& source, DetachedTag)
+    : component_(source.component_)
+    , parent_(source.parent_)
+    , parent_handle_(source.parent_handle_)
+    , owner_(source.owner_)
+    , name_(source.name_)
+    , uid_(source.uid_)
+    , handle_(source.handle_)
+    , is_active_(source.is_active_)
+    , is_signal_(source.is_signal_)
+    , property_metadata_(source.property_metadata_)
+    , property_metadata_epoch_(source.property_metadata_epoch_)
+    , signal_color_(source.signal_color_)
+    , is_detached_(true)
+{
+}
+
+CachedComponent::CachedComponent(daq::ComponentPtr component, DetachedTag)
+    : component_(component)
+    , is_detached_(true)
+{
+    UpdateState();
+}
+
+void CachedComponent::Attach()
+{
+    is_detached_ = false;
+    if (is_signal_)
+        signal_color_ = GetSignalColor();
+}
+
+CachedComponent::~CachedComponent()
+{
+    CancelPropertiesLoad();
+}
+
+void CachedComponent::SetParent(daq::ComponentPtr parent)
+{
+    parent_ = parent;
+    parent_handle_ = parent.assigned() ? InternComponentId(parent.getGlobalId().toStdString()) : INVALID_COMPONENT_HANDLE;
+}
+
 void CachedComponent::UpdateState()
 {
     if (!component_.assigned())
@@ -25,6 +83,7 @@ void CachedComponent::UpdateState()
     name_ = component_.getName().toStdString();
     is_active_ = (bool)component_.getActive();
     uid_ = component_.getGlobalId().toStdString();
+    handle_ = InternComponentId(uid_);
 
     is_locked_ = false;
     operation_mode_.clear();
@@ -39,7 +98,8 @@ void CachedComponent::UpdateState()
         }
         is_locked_ = (bool)device.isLocked();
     }
-    if (canCastTo<daq::ISignal>(component_))
+    is_signal_ = canCastTo<daq::ISignal>(component_);
+    if (is_signal_ && !is_detached_)
     {
         signal_color_ = GetSignalColor();
     }
@@ -47,21 +107,47 @@ void CachedComponent::UpdateState()
     RefreshStatus();
 }
 
-void CachedComponent::AddProperty(daq::PropertyPtr prop, daq::PropertyObjectPtr property_holder, int depth, const std::string& parent_uid)
+static bool IsEvaluated(const daq::BaseObjectPtr& value)
 {
-    properties_.push_back(CachedProperty());
-    CachedProperty& cached = properties_.back();
-    cached.property_ = prop;
-    cached.owner_ = this;
-    cached.depth_ = depth;
-    cached.name_ = prop.getName().toStdString();
-    cached.uid_ = parent_uid + cached.name_;
-    cached.unit_ = (prop.getUnit().assigned() && prop.getUnit().getSymbol().assigned()) ? static_cast<std::string>(prop.getUnit().getSymbol()) : "";
-    cached.display_name_ = cached.name_ + (cached.unit_.empty() ? "" : " [" + cached.unit_ + "]");
-    cached.is_read_only_ = prop.getReadOnly();
-    if (prop.getMinValue().assigned()) cached.min_value_ = (double)prop.getMinValue();
-    if (prop.getMaxValue().assigned()) cached.max_value_ = (double)prop.getMaxValue();
-    cached.type_ = prop.getValueType();
+    return value.assigned() && value.supportsInterface<daq::IEvalValue>();
+}
+
+// Visibility is not part of the cached metadata, and hidden properties are not cached at all, so any visibility
+// expression among a holder's properties means a value change can add or remove rows
+static bool HasEvaluatedVisibility(const daq::PropertyObjectPtr& property_holder)
+{
+    for (const auto& prop : property_holder.getAllProperties())
+    {
+        auto internal = prop.asPtrOrNull<daq::IPropertyInternal>(true);
+        if (!internal.assigned() || IsEvaluated(internal.getVisibleUnresolved()))
+            return true;
+    }
+    return false;
+}
+
+static CachedComponent::PropertyMetadata ReadPropertyMetadata(const daq::PropertyPtr& prop, const daq::PropertyObjectPtr& property_holder)
+{
+    CachedComponent::PropertyMetadata metadata;
+    metadata.holder = property_holder;
+    // limits, units etc. can be expressions over other properties (e.g. "$Range"), those have to be re-evaluated
+    if (auto internal = prop.asPtrOrNull<daq::IPropertyInternal>(true); internal.assigned())
+    {
+        metadata.is_dynamic = IsEvaluated(internal.getUnitUnresolved()) || IsEvaluated(internal.getMinValueUnresolved())
+                              || IsEvaluated(internal.getMaxValueUnresolved()) || IsEvaluated(internal.getReadOnlyUnresolved())
+                              || IsEvaluated(internal.getSelectionValuesUnresolved()) || internal.getReferencedPropertyUnresolved().assigned();
+    }
+    else
+    {
+        metadata.is_dynamic = true;
+    }
+
+    metadata.unit = (prop.getUnit().assigned() && prop.getUnit().getSymbol().assigned()) ? static_cast<std::string>(prop.getUnit().getSymbol()) : "";
+    metadata.is_read_only = prop.getReadOnly();
+    if (prop.getMinValue().assigned()) metadata.min_value = (double)prop.getMinValue();
+    if (prop.getMaxValue().assigned()) metadata.max_value = (double)prop.getMaxValue();
+    metadata.type = prop.getValueType();
+    if (metadata.type == daq::ctList)
+        metadata.item_type = prop.getItemType();
 
     if (auto sv = prop.getSelectionValues(); sv.assigned())
     {
@@ -84,39 +170,80 @@ void CachedComponent::AddProperty(daq::PropertyPtr prop, daq::PropertyObjectPtr
                 else
                     values << static_cast<std::string>(val) << '\0';
             }
-            cached.selection_values_ = values.str();
-            cached.selection_values_count_ = (int)selection_values.getCount();
+            metadata.selection_values = values.str();
+            metadata.selection_values_count = (int)selection_values.getCount();
         }
     }
+    return metadata;
+}
+
+void CachedComponent::InvalidatePropertyMetadata()
+{
+    property_metadata_.clear();
+    property_metadata_epoch_++;
+}
+
+void CachedComponent::AddProperty(daq::PropertyPtr prop, daq::PropertyObjectPtr property_holder, int depth, const std::string& parent_uid)
+{
+    properties_.push_back(CachedProperty());
+    CachedProperty& cached = properties_.back();
+    cached.property_ = prop;
+    cached.owner_ = this;
+    cached.depth_ = depth;
+    cached.name_ = prop.getName().toStdString();
+    cached.uid_ = parent_uid + cached.name_;
+
+    auto metadata_it = property_metadata_.find(cached.uid_);
+    if (metadata_it == property_metadata_.end() || metadata_it->second.is_dynamic
+        || metadata_it->second.holder.getObject() != property_holder.getObject())
+    {
+        metadata_it = property_metadata_.insert_or_assign(cached.uid_, ReadPropertyMetadata(prop, property_holder)).first;
+        property_metadata_misses_++;
+    }
+    else
+    {
+        property_metadata_hits_++;
+    }
+    const PropertyMetadata& metadata = metadata_it->second;
+    has_dependent_properties_ |= metadata.is_dynamic;
+    cached.unit_ = metadata.unit;
+    cached.display_name_ = cached.name_ + (cached.unit_.empty() ? "" : " [" + cached.unit_ + "]");
+    cached.is_read_only_ = metadata.is_read_only;
+    cached.min_value_ = metadata.min_value;
+    cached.max_value_ = metadata.max_value;
+    cached.type_ = metadata.type;
+    cached.selection_values_ = metadata.selection_values;
+    cached.selection_values_count_ = metadata.selection_values_count;
 
     try
     {
         switch (cached.type_)
         {
             case daq::ctBool:
-                cached.value_ = (bool)property_holder.getPropertyValue(cached.name_);
+                cached.value_ = (bool)property_holder.getPropertyValue(cached.name_.str());
                 break;
             case daq::ctInt:
-                cached.value_ = (int64_t)property_holder.getPropertyValue(cached.name_);
+                cached.value_ = (int64_t)property_holder.getPropertyValue(cached.name_.str());
                 break;
             case daq::ctFloat:
-                cached.value_ = (double)property_holder.getPropertyValue(cached.name_);
+                cached.value_ = (double)property_holder.getPropertyValue(cached.name_.str());
                 break;
             case daq::ctString:
-                cached.value_ = static_cast<std::string>(property_holder.getPropertyValue(cached.name_));
+                cached.value_ = static_cast<std::string>(property_holder.getPropertyValue(cached.name_.str()));
                 break;
             case daq::ctObject:
                 {
                     std::string new_parent_uid = cached.uid_ + ".";
-                    daq::PropertyObjectPtr parent = property_holder.getPropertyValue(cached.name_);
+                    daq::PropertyObjectPtr parent = property_holder.getPropertyValue(cached.name_.str());
+                    has_dependent_properties_ |= HasEvaluatedVisibility(parent);
                     for (const auto& sub_property : parent.getVisibleProperties())
                         AddProperty(sub_property, parent, depth + 1, new_parent_uid);
                 }
                 break;
             case daq::ctList:
                 {
-                    daq::ListPtr<daq::IBaseObject> list = property_holder.getPropertyValue(cached.name_);
-                    daq::CoreType item_type = prop.getItemType();
+                    daq::ListPtr<daq::IBaseObject> list = property_holder.getPropertyValue(cached.name_.str());
+                    daq::CoreType item_type = metadata.item_type;
 
                     // if property doesn't declare item type, detect from first element
                     if (item_type == daq::ctUndefined && list.assigned() && list.getCount() > 0)
@@ -153,11 +280,11 @@ void CachedComponent::AddProperty(daq::PropertyPtr prop, daq::PropertyObjectPtr
             case daq::ctEnumeration:
                 cached.is_read_only_ = true;
                 cached.type_ = daq::ctString;
-                cached.value_ = ValueToString(property_holder.getPropertyValue(cached.name_));
+                cached.value_ = ValueToString(property_holder.getPropertyValue(cached.name_.str()));
                 break;
             case daq::ctStruct:
                 {
-                    auto struct_value = property_holder.getPropertyValue(cached.name_).asPtr<daq::IStruct>();
+                    auto struct_value = property_holder.getPropertyValue(cached.name_.str()).asPtr<daq::IStruct>();
                     auto field_names = struct_value.getFieldNames();
                     auto field_values = struct_value.getFieldValues();
                     for (size_t i = 0; i < field_names.getCount(); i++)
@@ -384,10 +511,11 @@ void CachedComponent::RefreshStatus()
     warning_message_ = "";
     if (auto status_container = component_.getStatusContainer(); status_container.assigned())
     {
-        if (!status_container.getStatuses().hasKey("ComponentStatus"))
+        auto statuses = status_container.getStatuses();
+        if (!statuses.hasKey("ComponentStatus"))
             return;
 
-        std::string severity = status_container.getStatuses().get("ComponentStatus").getValue().toStdString();
+        std::string severity = statuses.get("ComponentStatus").getValue().toStdString();
         if (severity == "Ok")
             return;
 
@@ -402,15 +530,16 @@ void CachedComponent::RefreshStatus()
     }
 }
 
-void CachedComponent::RefreshProperties()
+void CachedComponent::RefreshProperties(const std::atomic<bool>* cancelled)
 {
     assert(component_.assigned());
 
     properties_.clear();
     attributes_.clear();
-    signal_descriptor_properties_.clear();
-    signal_domain_descriptor_properties_.clear();
     initial_properties_loaded_ = true;
+    has_dependent_properties_ = false;
+    property_metadata_hits_ = 0;
+    property_metadata_misses_ = 0;
 
     UpdateState();
 
@@ -528,15 +657,6 @@ void CachedComponent::RefreshProperties()
             } catch (...) { value = "<unavailable>"; }
             AddAttribute(attributes_, "@Status", "Status", value, true, true);
         }
-
-        if (auto descriptor = signal.getDescriptor(); descriptor.assigned())
-            AddDescriptorProperties(descriptor, signal_descriptor_properties_);
-
-        if (auto domain_signal = signal.getDomainSignal(); domain_signal.assigned())
-        {
-            if (auto descriptor = domain_signal.getDescriptor(); descriptor.assigned())
-                AddDescriptorProperties(descriptor, signal_domain_descriptor_properties_, true);
-        }
     }
 
     if (canCastTo<daq::IInputPort>(component_))
@@ -566,131 +686,337 @@ void CachedComponent::RefreshProperties()
     }
 
     daq::PropertyObjectPtr property_holder = castTo<daq::IPropertyObject>(component_);
+    has_dependent_properties_ |= HasEvaluatedVisibility(property_holder);
     for (const auto& prop : property_holder.getVisibleProperties())
+    {
+        if (cancelled && cancelled->load())
+            return;
         AddProperty(prop, property_holder);
+    }
+
+    property_index_by_uid_.clear();
+    for (size_t i = 0; i < properties_.size(); ++i)
+        property_index_by_uid_.emplace(properties_[i].uid_, i);
+    properties_version_++;
 }
 
-void CachedProperty::SetValue(ValueType value)
+void CachedComponent::RefreshDescriptorProperties()
 {
-    daq::ComponentPtr component = owner_->component_;
-    if (!component.assigned())
+    signal_descriptor_properties_.clear();
+    signal_domain_descriptor_properties_.clear();
+    domain_signal_id_.clear();
+    descriptor_properties_loaded_ = true;
+    descriptor_properties_requested_ = false;
+    properties_version_++;
+    if (!is_signal_ || !component_.assigned())
         return;
 
     try
     {
-        // attribute changes have special non-generic logic
-        if (name_.size() > 1 && name_[0] == '@')
+        daq::SignalPtr signal = castTo<daq::ISignal>(component_);
+        if (auto descriptor = signal.getDescriptor(); descriptor.assigned())
+            AddDescriptorProperties(descriptor, signal_descriptor_properties_);
+
+        if (auto domain_signal = signal.getDomainSignal(); domain_signal.assigned())
         {
-            if (name_ == "@OperationMode")
-            {
-                assert(canCastTo<daq::IDevice>(component));
-                daq::DevicePtr device = castTo<daq::IDevice>(component);
-                device.setOperationMode(device.getAvailableOperationModes().getItemAt(std::get<int64_t>(value)));
-            }
-            else if (name_ == "@Recording")
-            {
-                assert(canCastTo<daq::IRecorder>(component));
-                daq::RecorderPtr recorder = castTo<daq::IRecorder>(component);
-                if (std::get<bool>(value))
-                    recorder.startRecording();
-                else
-                    recorder.stopRecording();
-            }
-            else if (name_ == "@Locked")
-            {
-                assert(canCastTo<daq::IDevice>(component));
-                daq::DevicePtr device = castTo<daq::IDevice>(component);
-                if (std::get<bool>(value))
-                    device.lock();
-                else
-                    device.unlock();
-            }
-            else if (name_ == "@Name")
-            {
-                component.setName(std::get<std::string>(value));
-            }
-            else if (name_ == "@Description")
-            {
-                component.setDescription(std::get<std::string>(value));
-            }
-            else if (name_ == "@Active")
-            {
-                component.setActive(std::get<bool>(value));
-            }
-            else if (name_ == "@Visible")
-            {
-                component.setVisible(std::get<bool>(value));
-            }
-            else if (name_ == "@Public")
-            {
-                assert(canCastTo<daq::ISignal>(component));
-                daq::SignalPtr signal = castTo<daq::ISignal>(component);
-                signal.setPublic(std::get<bool>(value));
-            }
-            else if (name_ == "@SignalColor")
-            {
-                owner_->signal_color_ = ImGui::ColorConvertU32ToFloat4((ImU32)std::get<int64_t>(value));
-                value_ = value;
-                owner_->needs_resync_ = false; // no refresh needed component over a non-opendaq property
-                return;
-            }
-            owner_->needs_resync_ = true;
-            return;
+            domain_signal_id_ = domain_signal.getGlobalId().toStdString();
+            if (auto descriptor = domain_signal.getDescriptor(); descriptor.assigned())
+                AddDescriptorProperties(descriptor, signal_domain_descriptor_properties_, true);
         }
+    }
+    catch (const std::exception& e)
+    {
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to read descriptor of '%s': %s", name_.c_str(), e.what()});
+    }
+}
+
+void CachedComponent::BeginPropertiesLoad()
+{
+    PruneAbandonedPropertyLoads();
+    if (IsLoadingProperties() || !component_.assigned())
+        return;
+
+    needs_resync_ = false;
+    properties_load_started_ = std::chrono::steady_clock::now();
+    properties_load_cancelled_ = std::make_shared<std::atomic<bool>>(false);
 
-        assert(canCastTo<daq::IPropertyObject>(component));
-        daq::PropertyObjectPtr property_holder = castTo<daq::IPropertyObject>(component);
-        switch (type_)
+    // the copy is only touched by the worker until the future is ready; its lists are sized from the previous
+    // load so each one is allocated once instead of growing property by property
+    auto detached = std::unique_ptr<CachedComponent>(new CachedComponent(*this, DetachedTag{}));
+    detached->attributes_.reserve(attributes_.size());
+    detached->properties_.reserve(properties_.size());
+    properties_load_ = std::async(std::launch::async, [detached = std::move(detached), cancelled = properties_load_cancelled_]() mutable
+        {
+            detached->RefreshProperties(cancelled.get());
+            return std::move(detached);
+        });
+}
+
+bool CachedComponent::PollPropertiesLoad()
+{
+    if (!IsLoadingProperties() || properties_load_.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    std::unique_ptr<CachedComponent> loaded;
+    try
+    {
+        loaded = properties_load_.get();
+    }
+    catch (const std::exception& e)
+    {
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to load properties of '%s': %s", name_.c_str(), e.what()});
+    }
+    catch (...)
+    {
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to load properties of '%s': Unknown error", name_.c_str()});
+    }
+    properties_load_ms_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - properties_load_started_).count();
+    properties_load_cancelled_.reset();
+    // the copy was read before a local write landed and holds the old value, so it is read once more
+    if (last_local_write_ > properties_load_started_)
+        needs_resync_ = true;
+
+    // a failed load still counts as loaded, otherwise it would be retried every frame
+    initial_properties_loaded_ = true;
+    properties_version_++;
+    if (!loaded)
+        return true;
+
+    name_ = std::move(loaded->name_);
+    is_active_ = loaded->is_active_;
+    is_locked_ = loaded->is_locked_;
+    operation_mode_ = std::move(loaded->operation_mode_);
+    warning_message_ = std::move(loaded->warning_message_);
+    error_message_ = std::move(loaded->error_message_);
+    attributes_ = std::move(loaded->attributes_);
+    properties_ = std::move(loaded->properties_);
+    property_index_by_uid_ = std::move(loaded->property_index_by_uid_);
+    has_dependent_properties_ = loaded->has_dependent_properties_;
+    if (loaded->property_metadata_epoch_ == property_metadata_epoch_)
+        property_metadata_ = std::move(loaded->property_metadata_);
+    property_metadata_hits_ = loaded->property_metadata_hits_;
+    property_metadata_misses_ = loaded->property_metadata_misses_;
+    for (auto* list : { &attributes_, &properties_ })
+    {
+        for (CachedProperty& property : *list)
+            property.owner_ = this;
+    }
+    return true;
+}
+
+void CachedComponent::CancelPropertiesLoad()
+{
+    if (!IsLoadingProperties())
+        return;
+
+    properties_load_cancelled_->store(true);
+    properties_load_cancelled_.reset();
+    // without an owner to park it with, the cancelled load is waited for right here
+    if (abandoned_property_loads_)
+        abandoned_property_loads_->push_back(std::move(properties_load_));
+    else
+        properties_load_ = {};
+}
+
+CachedProperty* CachedComponent::FindProperty(const std::string& uid)
+{
+    if (auto it = property_index_by_uid_.find(uid); it != property_index_by_uid_.end())
+        return &properties_[it->second];
+    auto it = std::find_if(attributes_.begin(), attributes_.end(), [&](const CachedProperty& attribute) { return attribute.uid_ == uid; });
+    return it != attributes_.end() ? &*it : nullptr;
+}
+
+bool CachedComponent::RefreshPropertyValue(const std::string& property_uid, const daq::BaseObjectPtr& value)
+{
+    // other rows may be derived from the changed value, only the full re-read brings those along
+    if (has_dependent_properties_)
+        return false;
+
+    auto it = property_index_by_uid_.find(property_uid);
+    if (it == property_index_by_uid_.end() || !value.assigned())
+        return false;
+
+    // objects, structs, lists and values that are displayed as text carry derived state, so those are re-read in full
+    CachedProperty& cached = properties_[it->second];
+    if (!cached.property_.assigned())
+        return false;
+
+    try
+    {
+        switch (cached.type_)
         {
             case daq::ctBool:
-                property_holder.setPropertyValue(uid_, std::get<bool>(value)); break;
+                cached.value_ = (bool)value;
+                break;
             case daq::ctInt:
-                property_holder.setPropertyValue(uid_, std::get<int64_t>(value)); break;
+                cached.value_ = (int64_t)value;
+                break;
             case daq::ctFloat:
-                property_holder.setPropertyValue(uid_, std::get<double>(value)); break;
+                cached.value_ = (double)value;
+                break;
             case daq::ctString:
-                property_holder.setPropertyValue(uid_, std::get<std::string>(value)); break;
-            case daq::ctProc:
-                property_holder.getPropertyValue(uid_).asPtr<daq::IProcedure>().dispatch(); break;
-            case daq::ctFunc:
-                property_holder.getPropertyValue(uid_).asPtr<daq::IFunction>().dispatch(); break;
-            case daq::ctList:
-            {
-                std::string str = std::get<std::string>(value);
-                daq::ListPtr<daq::IBaseObject> list = daq::List<daq::IBaseObject>();
+                cached.value_ = static_cast<std::string>(value);
+                break;
+            default:
+                return false;
+        }
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    properties_version_++;
+    return true;
+}
+
+void CachedProperty::WriteValue(const daq::ComponentPtr& component, const ValueType& value) const
+{
+    if (!component.assigned())
+        return;
+
+    // attribute changes have special non-generic logic
+    if (name_.size() > 1 && name_[0] == '@')
+    {
+        if (name_ == "@OperationMode")
+        {
+            assert(canCastTo<daq::IDevice>(component));
+            daq::DevicePtr device = castTo<daq::IDevice>(component);
+            device.setOperationMode(device.getAvailableOperationModes().getItemAt(std::get<int64_t>(value)));
+        }
+        else if (name_ == "@Recording")
+        {
+            assert(canCastTo<daq::IRecorder>(component));
+            daq::RecorderPtr recorder = castTo<daq::IRecorder>(component);
+            if (std::get<bool>(value))
+                recorder.startRecording();
+            else
+                recorder.stopRecording();
+        }
+        else if (name_ == "@Locked")
+        {
+            assert(canCastTo<daq::IDevice>(component));
+            daq::DevicePtr device = castTo<daq::IDevice>(component);
+            if (std::get<bool>(value))
+                device.lock();
+            else
+                device.unlock();
+        }
+        else if (name_ == "@Name")
+        {
+            component.setName(std::get<std::string>(value));
+        }
+        else if (name_ == "@Description")
+        {
+            component.setDescription(std::get<std::string>(value));
+        }
+        else if (name_ == "@Active")
+        {
+            component.setActive(std::get<bool>(value));
+        }
+        else if (name_ == "@Visible")
+        {
+            component.setVisible(std::get<bool>(value));
+        }
+        else if (name_ == "@Public")
+        {
+            assert(canCastTo<daq::ISignal>(component));
+            daq::SignalPtr signal = castTo<daq::ISignal>(component);
+            signal.setPublic(std::get<bool>(value));
+        }
+        return;
+    }
 
-                // strip outer brackets and whitespace
-                size_t start = str.find('[');
-                size_t end = str.rfind(']');
-                if (start != std::string::npos && end != std::string::npos && end > start)
+    assert(canCastTo<daq::IPropertyObject>(component));
+    daq::PropertyObjectPtr property_holder = castTo<daq::IPropertyObject>(component);
+    switch (type_)
+    {
+        case daq::ctBool:
+            property_holder.setPropertyValue(uid_, std::get<bool>(value)); break;
+        case daq::ctInt:
+            property_holder.setPropertyValue(uid_, std::get<int64_t>(value)); break;
+        case daq::ctFloat:
+            property_holder.setPropertyValue(uid_, std::get<double>(value)); break;
+        case daq::ctString:
+            property_holder.setPropertyValue(uid_, std::get<std::string>(value)); break;
+        case daq::ctProc:
+            property_holder.getPropertyValue(uid_).asPtr<daq::IProcedure>().dispatch(); break;
+        case daq::ctFunc:
+            property_holder.getPropertyValue(uid_).asPtr<daq::IFunction>().dispatch(); break;
+        case daq::ctList:
+        {
+            std::string str = std::get<std::string>(value);
+            daq::ListPtr<daq::IBaseObject> list = daq::List<daq::IBaseObject>();
+
+            // strip outer brackets and whitespace
+            size_t start = str.find('[');
+            size_t end = str.rfind(']');
+            if (start != std::string::npos && end != std::string::npos && end > start)
+            {
+                std::string inner = str.substr(start + 1, end - start - 1);
+                std::istringstream stream(inner);
+                std::string token;
+                while (std::getline(stream, token, ','))
                 {
-                    std::string inner = str.substr(start + 1, end - start - 1);
-                    std::istringstream stream(inner);
-                    std::string token;
-                    while (std::getline(stream, token, ','))
-                    {
-                        // trim whitespace
-                        size_t first = token.find_first_not_of(" \t");
-                        if (first == std::string::npos)
-                            continue;
-                        token = token.substr(first, token.find_last_not_of(" \t") - first + 1);
-
-                        if (list_item_type_.has_value() && *list_item_type_ == daq::ctInt)
-                            list.pushBack(daq::Integer(std::stoll(token)));
-                        else if (list_item_type_.has_value() && *list_item_type_ == daq::ctFloat)
-                            list.pushBack(daq::Float(std::stod(token)));
-                    }
-                }
+                    // trim whitespace
+                    size_t first = token.find_first_not_of(" \t");
+                    if (first == std::string::npos)
+                        continue;
+                    token = token.substr(first, token.find_last_not_of(" \t") - first + 1);
 
-                property_holder.setPropertyValue(uid_, list);
-                break;
+                    if (list_item_type_.has_value() && *list_item_type_ == daq::ctInt)
+                        list.pushBack(daq::Integer(std::stoll(token)));
+                    else if (list_item_type_.has_value() && *list_item_type_ == daq::ctFloat)
+                        list.pushBack(daq::Float(std::stod(token)));
+                }
             }
-            default:
-                assert(false && "unsupported property type");
-                return;
+
+            property_holder.setPropertyValue(uid_, list);
+            break;
         }
+        default:
+            assert(false && "unsupported property type");
+            return;
+    }
+}
 
-        owner_->needs_resync_ = true;
+bool CachedProperty::IsLocalOnly() const
+{
+    return name_ == "@SignalColor";
+}
+
+void CachedProperty::ApplyWrittenValue(const ValueType& value)
+{
+    owner_->last_local_write_ = std::chrono::steady_clock::now();
+    if (name_ == "@SignalColor")
+    {
+        owner_->signal_color_ = ImGui::ColorConvertU32ToFloat4((ImU32)std::get<int64_t>(value));
+        value_ = value;
+        return; // no refresh needed, the color is not an openDAQ property
+    }
+
+    if ((name_.size() <= 1 || name_[0] != '@') && !owner_->has_dependent_properties_)
+    {
+        if (type_ == daq::ctBool || type_ == daq::ctInt || type_ == daq::ctFloat || type_ == daq::ctString)
+        {
+            // the PropertyValueChanged event patches in the value the device actually accepted
+            value_ = value;
+            owner_->properties_version_++;
+            return;
+        }
+    }
+    owner_->needs_resync_ = true;
+}
+
+void CachedProperty::SetValue(ValueType value)
+{
+    if (!owner_->component_.assigned())
+        return;
+
+    try
+    {
+        WriteValue(owner_->component_, value);
+        ApplyWrittenValue(value);
     }
     catch (const std::exception& e)
     {
@@ -702,6 +1028,184 @@ void CachedProperty::SetValue(ValueType value)
     }
 }
 
+static daq::DevicePtr FindOwningDevice(daq::ComponentPtr component)
+{
+    while (component.assigned() && !canCastTo<daq::IDevice>(component))
+        component = component.getParent();
+    return component.assigned() ? castTo<daq::IDevice>(component) : daq::DevicePtr();
+}
+
+void PropertyWriteQueue::WriteNow(CachedProperty* target, const CachedProperty::ValueType& value)
+{
+    target->SetValue(value);
+    if (on_property_changed_ && target->owner_)
+        on_property_changed_(target->owner_->uid_, target->name_);
+}
+
+void PropertyWriteQueue::Write(const std::vector<CachedProperty*>& targets, const CachedProperty::ValueType& value)
+{
+    std::unordered_map<std::string, Batch> new_batches;
+    for (CachedProperty* target : targets)
+    {
+        if (target->IsLocalOnly())
+        {
+            WriteNow(target, value);
+            continue;
+        }
+        daq::ComponentPtr component = target->owner_->component_;
+        if (!component.assigned())
+            continue;
+        daq::DevicePtr device = FindOwningDevice(component);
+        std::string device_id = device.assigned() ? device.getGlobalId().toStdString() : std::string();
+
+        // a single write is quick enough to run in place, unless it would overtake a batch still running on the device
+        auto queue = batches_by_device_.find(device_id);
+        if (targets.size() == 1 && (queue == batches_by_device_.end() || queue->second.empty()))
+        {
+            WriteNow(target, value);
+            continue;
+        }
+
+        Batch& batch = new_batches[device_id];
+        batch.targets.push_back({target->owner_->uid_, component, *target});
+        batch.targets.back().property.owner_ = nullptr;
+    }
+
+    for (auto& [device_id, batch] : new_batches)
+    {
+        batch.value = value;
+        std::deque<Batch>& queue = batches_by_device_[device_id];
+        queue.push_back(std::move(batch));
+        if (queue.size() == 1 && !Start(queue.front()))
+            queue.pop_front();
+    }
+}
+
+bool PropertyWriteQueue::Start(Batch& batch)
+{
+    try
+    {
+        batch.write = std::async(std::launch::async, [targets = batch.targets, value = batch.value]()
+            {
+                std::vector<std::string> errors(targets.size());
+                // components are taken in order, so a component's writes are next to each other
+                size_t group_begin = 0;
+                while (group_begin < targets.size())
+                {
+                    size_t group_end = group_begin;
+                    while (group_end < targets.size() && targets[group_end].component == targets[group_begin].component)
+                        group_end++;
+
+                    daq::PropertyObjectPtr updating;
+                    for (size_t i = group_begin; i < group_end; ++i)
+                    {
+                        const Target& target = targets[i];
+                        try
+                        {
+                            bool is_attribute = target.property.name_.size() > 1 && target.property.name_[0] == '@';
+                            if (!is_attribute && !updating.assigned())
+                            {
+                                daq::PropertyObjectPtr holder = castTo<daq::IPropertyObject>(target.component);
+                                holder.beginUpdate();
+                                updating = holder;
+                            }
+                            target.property.WriteValue(target.component, value);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            errors[i] = e.what();
+                        }
+                        catch (...)
+                        {
+                            errors[i] = "Unknown error";
+                        }
+                    }
+
+                    if (updating.assigned())
+                    {
+                        // the grouped writes are only committed here, so a failure belongs to all of them
+                        std::string update_error;
+                        try
+                        {
+                            updating.endUpdate();
+                        }
+                        catch (const std::exception& e)
+                        {
+                            update_error = e.what();
+                        }
+                        catch (...)
+                        {
+                            update_error = "Unknown error";
+                        }
+                        if (!update_error.empty())
+                        {
+                            for (size_t i = group_begin; i < group_end; ++i)
+                            {
+                                if (errors[i].empty())
+                                    errors[i] = update_error;
+                            }
+                        }
+                    }
+                    group_begin = group_end;
+                }
+                return errors;
+            });
+    }
+    catch (const std::exception& e)
+    {
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to set property value: %s", e.what()});
+        return false;
+    }
+    return true;
+}
+
+void PropertyWriteQueue::Poll(const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components)
+{
+    for (auto device = batches_by_device_.begin(); device != batches_by_device_.end(); )
+    {
+        std::deque<Batch>& queue = device->second;
+        while (!queue.empty() && queue.front().write.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            Batch& batch = queue.front();
+            std::vector<std::string> errors = batch.write.get();
+            for (size_t i = 0; i < batch.targets.size(); ++i)
+            {
+                const Target& target = batch.targets[i];
+                auto component_it = all_components.find(target.component_id);
+                CachedComponent* owner = component_it != all_components.end() ? component_it->second.get() : nullptr;
+                if (!errors[i].empty())
+                {
+                    const std::string& component_name = owner ? owner->name_ : target.component_id;
+                    ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to set %s of %s: %s",
+                                               target.property.display_name_.c_str(), component_name.c_str(), errors[i].c_str()});
+                }
+                if (!owner)
+                    continue;
+
+                // a failed write may have been applied in part, so only the failed components are re-read
+                CachedProperty* cached = errors[i].empty() ? owner->FindProperty(target.property.uid_) : nullptr;
+                if (!cached)
+                {
+                    owner->needs_resync_ = true;
+                    continue;
+                }
+                cached->ApplyWrittenValue(batch.value);
+                if (on_property_changed_)
+                    on_property_changed_(target.component_id, target.property.name_);
+            }
+
+            queue.pop_front();
+            while (!queue.empty() && !Start(queue.front()))
+                queue.pop_front();
+        }
+
+        if (queue.empty())
+            device = batches_by_device_.erase(device);
+        else
+            ++device;
+    }
+}
+
 void CachedProperty::EnsureFunctionInfoCached()
 {
     if (function_info_.has_value())
@@ -734,6 +1238,34 @@ void CachedProperty::EnsureFunctionInfoCached()
     }
 }
 
+static size_t StringFootprint(const std::string& text)
+{
+    // strings that fit the small string buffer do not allocate, its size differs between standard libraries
+    static const size_t small_string_capacity = std::string().capacity();
+    return sizeof(std::string) + (text.size() > small_string_capacity ? text.size() + 1 : 0);
+}
+
+CachedComponent::MemoryReport CachedComponent::BuildMemoryReport(const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components)
+{
+    MemoryReport report;
+    for (const auto& [_, component] : all_components)
+    {
+        for (const auto* list : { &component->attributes_, &component->properties_, &component->signal_descriptor_properties_, &component->signal_domain_descriptor_properties_ })
+        {
+            for (const CachedProperty& property : *list)
+            {
+                report.properties++;
+                report.interned_bytes += 3 * sizeof(InternedString);
+                report.per_property_bytes += StringFootprint(property.name_) + StringFootprint(property.unit_) + StringFootprint(property.display_name_);
+            }
+        }
+    }
+    InternedString::TableStats table = InternedString::GetTableStats();
+    report.interned_strings = table.strings;
+    report.interned_bytes += table.bytes;
+    return report;
+}
+
 ImVec4 CachedComponent::GetSignalColor()
 {
     // synchronize the color between cached component and global signal color map
@@ -1,11 +1,20 @@
 #pragma once
 #include <opendaq/opendaq.h>
 #include "nodes.h"
+#include "interned_string.h"
+#include "component_handle.h"
 #include <variant>
 #include <string>
 #include <optional>
 #include <vector>
 #include <unordered_map>
+#include <memory>
+#include <future>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <cstdint>
 
 
 struct CachedComponent;
@@ -15,15 +24,24 @@ struct CachedProperty
     using ValueType = std::variant<std::string, int64_t, double, bool>;
 
     void SetValue(ValueType value);
+    // Remote part of SetValue, throws on failure. Only reads the property's own fields, so a copy of it can be
+    // written from a worker thread while the cache it came from is rebuilt.
+    void WriteValue(const daq::ComponentPtr& component, const ValueType& value) const;
+    // Local bookkeeping after a successful write, UI thread only
+    void ApplyWrittenValue(const ValueType& value);
+    // Attributes that only live in the cache, like the signal color, and are never written to the device
+    bool IsLocalOnly() const;
 
     daq::PropertyPtr property_;
     CachedComponent* owner_ = nullptr;
 
     daq::CoreType type_;
-    std::string name_;
+    // identical across every channel of the same kind, so they are interned rather than copied per property;
+    // uids and selection lists are not, the table is never freed and those can change at runtime
+    InternedString name_;
     std::string uid_;
-    std::string unit_;
-    std::string display_name_;
+    InternedString unit_;
+    InternedString display_name_;
     int depth_{0};
     bool is_read_only_{false};
     bool is_debug_property_{false};
@@ -51,50 +69,164 @@ struct CachedProperty
     void EnsureFunctionInfoCached();
 };
 
+// Writes the same value to many properties without blocking the UI thread: one worker per device, and the writes
+// to each component are grouped in a beginUpdate/endUpdate block. Finished writes are taken in once per frame.
+// A device's batches run one after another, so quick successive edits land in the order they were made.
+class PropertyWriteQueue
+{
+public:
+    void Write(const std::vector<CachedProperty*>& targets, const CachedProperty::ValueType& value);
+    // The targets are looked up again by id, their caches may have been rebuilt while the write was running
+    void Poll(const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components);
+
+    // Called with the component id and property name once a write has been applied to the cache
+    std::function<void(const std::string&, const std::string&)> on_property_changed_;
+
+private:
+    struct Target
+    {
+        std::string component_id;
+        daq::ComponentPtr component;
+        CachedProperty property; // a copy, the cached one may be gone by the time the worker gets to it
+    };
+    struct Batch
+    {
+        std::vector<Target> targets;
+        CachedProperty::ValueType value;
+        std::future<std::vector<std::string>> write; // an error message per target, empty on success
+    };
+    bool Start(Batch& batch);
+    void WriteNow(CachedProperty* target, const CachedProperty::ValueType& value);
+
+    // the front batch of each device is running, the ones behind it wait until it has landed
+    std::unordered_map<std::string, std::deque<Batch>> batches_by_device_;
+};
+
+// Raw core events received vs. rebuilds, patches and events actually dispatched after reduction
+struct CoreEventStats
+{
+    uint64_t received = 0;
+    uint64_t applied = 0;
+};
+
 struct CachedComponent
 {
     CachedComponent(daq::ComponentPtr component);
+    ~CachedComponent();
+
+    struct DetachedTag {};
+    CachedComponent(const CachedComponent& source, DetachedTag);
+    // Reads a component on a worker thread, Attach takes it over to the UI thread
+    CachedComponent(daq::ComponentPtr component, DetachedTag);
+    void Attach();
 
     void UpdateState();
     void RefreshStatus();
-    void RefreshProperties();
+    void RefreshProperties(const std::atomic<bool>* cancelled = nullptr);
+    // Reads properties into a detached copy on a background thread, PollPropertiesLoad applies it on the UI thread
+    void BeginPropertiesLoad();
+    bool PollPropertiesLoad();
+    void CancelPropertiesLoad();
+    bool IsLoadingProperties() const { return properties_load_.valid(); }
+    // Patches a single cached property after a PropertyValueChanged event, returns false if a full refresh is needed instead
+    bool RefreshPropertyValue(const std::string& property_uid, const daq::BaseObjectPtr& value);
+    // The cached property or attribute with the uid, nullptr if it is not cached (anymore)
+    CachedProperty* FindProperty(const std::string& uid);
     void RefreshStructure();
     void AddProperty(daq::PropertyPtr prop, daq::PropertyObjectPtr property_holder, int depth = 0, const std::string& parent_uid = "");
+    // Descriptor lists are only filled once their tab is shown and then kept until the descriptor changes
+    void RefreshDescriptorProperties();
+    void InvalidateDescriptorProperties() { descriptor_properties_loaded_ = false; }
     void AddDescriptorProperties(daq::DataDescriptorPtr descriptor, std::vector<CachedProperty>& properties, bool is_domain_signal = false);
     CachedProperty& AddAttribute(std::vector<CachedProperty>& properties, const std::string& name, const std::string& display_name, CachedProperty::ValueType value, bool is_read_only = true, bool is_debug_property = false, daq::CoreType type = daq::ctString);
 
     daq::ComponentPtr component_;
     daq::ComponentPtr parent_; // the parent component in the hierarchy (although some folders are skipped)
+    ComponentHandle parent_handle_ = INVALID_COMPONENT_HANDLE;
+    void SetParent(daq::ComponentPtr parent);
     daq::ComponentPtr owner_; // the component that can delete this one
 
     std::string name_;
     std::string uid_;
+    ComponentHandle handle_ = INVALID_COMPONENT_HANDLE; // interned uid_
     std::string warning_message_;
     std::string error_message_;
     bool is_active_;
+    bool is_signal_ = false;
     bool is_locked_ = false;
     std::string operation_mode_;
     std::vector<CachedProperty> attributes_;
     std::vector<CachedProperty> properties_;
     std::vector<CachedProperty> signal_descriptor_properties_;
     std::vector<CachedProperty> signal_domain_descriptor_properties_;
+    std::string domain_signal_id_; // whose descriptor signal_domain_descriptor_properties_ was read from
+    bool descriptor_properties_loaded_ = false;
+    bool descriptor_properties_requested_ = false; // set while rendering, served before the next view rebuild
+    std::unordered_map<std::string, size_t> property_index_by_uid_; // index into properties_
+
+    // Unit, limits, selection values and such of a property, read once instead of on every refresh
+    struct PropertyMetadata
+    {
+        daq::PropertyObjectPtr holder; // the object the property was read from, a different one invalidates the entry
+        bool is_dynamic = false; // some of it is an evaluated expression, so it is re-read every time
+        daq::CoreType type = daq::ctUndefined;
+        daq::CoreType item_type = daq::ctUndefined;
+        InternedString unit;
+        bool is_read_only = false;
+        std::optional<double> min_value;
+        std::optional<double> max_value;
+        std::optional<std::string> selection_values;
+        int selection_values_count = 0;
+    };
+    std::unordered_map<std::string, PropertyMetadata> property_metadata_; // by property uid
+    uint64_t property_metadata_epoch_ = 0; // bumped by InvalidatePropertyMetadata so in-flight loads don't bring stale entries back
+    size_t property_metadata_hits_ = 0; // entries reused by the last refresh
+    size_t property_metadata_misses_ = 0;
+    void InvalidatePropertyMetadata();
 
     std::vector<ImGui::ImGuiNodesIdentifier> input_ports_;
     std::vector<ImGui::ImGuiNodesIdentifier> output_signals_;
-    std::vector<ImGui::ImGuiNodesIdentifier> children_;
+    std::vector<ComponentHandle> children_;
 
     int color_index_ = 0;
     std::optional<ImVec4> signal_color_;
 
     bool needs_resync_ = false;
+    // some property is derived from others (evaluated limits, selection lists, visibility), so a changed value
+    // cannot be patched in place and the whole list is re-read instead
+    bool has_dependent_properties_ = false;
     bool initial_properties_loaded_ = false;
+    uint64_t properties_version_ = 0; // bumped whenever cached property values change, so views know to rebuild
+    double properties_load_ms_ = -1.0; // duration of the last completed background load
+
+    std::future<std::unique_ptr<CachedComponent>> properties_load_;
+    std::shared_ptr<std::atomic<bool>> properties_load_cancelled_;
+    std::chrono::steady_clock::time_point properties_load_started_;
+    std::chrono::steady_clock::time_point last_local_write_;
+    bool is_detached_ = false; // a background load copy, must not touch shared state such as signal_colors_
 
     ImVec4 GetSignalColor();
 
+    // Compares the string footprint of the cached properties against storing every string per property
+    struct MemoryReport
+    {
+        size_t properties = 0;
+        size_t interned_strings = 0;
+        size_t interned_bytes = 0;  // handles in the properties plus the shared table
+        size_t per_property_bytes = 0; // what the same strings would take as std::string members
+    };
+    static MemoryReport BuildMemoryReport(const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components);
+
     static std::unordered_map<std::string, ImVec4> signal_colors_;
+    // cancelled loads nobody waits for anymore, kept so their destructors never block the UI thread;
+    // the list is owned by the node editor, which drains it while the openDAQ instance is still alive
+    static std::vector<std::future<std::unique_ptr<CachedComponent>>>* abandoned_property_loads_;
     static int next_signal_color_index_;
 
     static void* SettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name);
     static void SettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
     static void SettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
 };
+
+// Cached components of the current topology by handle, nullptr where nothing is cached
+using ComponentsByHandle = ComponentHandleMap<CachedComponent*>;
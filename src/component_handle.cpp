@@ -0,0 +1,40 @@
+#include "component_handle.h"
+#include <unordered_map>
+#include <deque>
+#include <mutex>
+
+
+// handles are also interned from property loads on background threads, so the table is shared behind a mutex;
+// unordered_map nodes never move, which keeps the key pointers in s_ids valid
+static std::mutex s_table_mutex;
+static std::unordered_map<std::string, ComponentHandle> s_handles;
+static std::deque<const std::string*> s_ids;
+
+ComponentHandle InternComponentId(const std::string& global_id)
+{
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    auto [it, inserted] = s_handles.try_emplace(global_id, (ComponentHandle)s_ids.size());
+    if (inserted)
+        s_ids.push_back(&it->first);
+    return it->second;
+}
+
+ComponentHandle FindComponentHandle(const std::string& global_id)
+{
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    auto it = s_handles.find(global_id);
+    return it != s_handles.end() ? it->second : INVALID_COMPONENT_HANDLE;
+}
+
+const std::string& ComponentIdOf(ComponentHandle handle)
+{
+    static const std::string empty;
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    return handle < s_ids.size() ? *s_ids[handle] : empty;
+}
+
+std::size_t ComponentHandleCount()
+{
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    return s_ids.size();
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+// Dense integer handle for a component's global ID. Each ID is interned once in a process-wide table and keeps its
+// handle for the rest of the run, so handles can index flat per-component arrays instead of string-keyed maps.
+using ComponentHandle = uint32_t;
+static constexpr ComponentHandle INVALID_COMPONENT_HANDLE = UINT32_MAX;
+
+ComponentHandle InternComponentId(const std::string& global_id);
+// INVALID_COMPONENT_HANDLE if the ID was never interned
+ComponentHandle FindComponentHandle(const std::string& global_id);
+const std::string& ComponentIdOf(ComponentHandle handle);
+std::size_t ComponentHandleCount();
+
+// Flat table from handle to a small value, T{} for handles that were never set
+template <typename T>
+class ComponentHandleMap
+{
+public:
+    T operator[](ComponentHandle handle) const { return handle < values_.size() ? values_[handle] : T{}; }
+    void Set(ComponentHandle handle, const T& value)
+    {
+        if (handle == INVALID_COMPONENT_HANDLE)
+            return;
+        if (handle >= values_.size())
+            values_.resize(handle + 1);
+        values_[handle] = value;
+    }
+    void Clear() { values_.clear(); }
+
+private:
+    std::vector<T> values_;
+};
@@ -0,0 +1,144 @@
+#include "device_discovery.h"
+#include <algorithm>
+#include <thread>
+
+
+static std::vector<DeviceDiscovery::FoundDevice> ToFoundDevices(const daq::ListPtr<daq::IDeviceInfo>& available_devices)
+{
+    std::vector<DeviceDiscovery::FoundDevice> devices;
+    if (available_devices.assigned())
+    {
+        devices.reserve(static_cast<size_t>(available_devices.getCount()));
+        for (const auto& device_info : available_devices)
+            devices.push_back({device_info.getName(), device_info.getConnectionString()});
+    }
+    return devices;
+}
+
+DeviceDiscovery::DeviceDiscovery(std::vector<Source> sources)
+{
+    for (Source& source : sources)
+    {
+        SourceState state;
+        state.source = std::move(source);
+        sources_.push_back(std::move(state));
+    }
+}
+
+void DeviceDiscovery::Refresh()
+{
+    auto now = std::chrono::steady_clock::now();
+    for (SourceState& state : sources_)
+    {
+        if (state.round.valid())
+            continue;
+        state.round = std::async(std::launch::async, state.source.discover);
+        state.round_started = now;
+    }
+    last_round_started_ = now;
+}
+
+std::vector<std::string> DeviceDiscovery::Update()
+{
+    std::vector<std::string> errors;
+    auto now = std::chrono::steady_clock::now();
+    bool devices_changed = false;
+
+    for (SourceState& state : sources_)
+    {
+        if (!state.round.valid() || state.round.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        // includes up to a frame of polling delay, which is noise next to a discovery round
+        state.last_latency_ms = std::chrono::duration<double, std::milli>(now - state.round_started).count();
+        try
+        {
+            for (const FoundDevice& found : state.round.get())
+            {
+                auto it = std::find_if(devices_.begin(), devices_.end(),
+                                       [&](const Device& device) { return device.connection_string == found.connection_string; });
+                if (it == devices_.end())
+                {
+                    devices_.push_back({found.name, found.connection_string, state.source.name, now});
+                }
+                else
+                {
+                    it->name = found.name;
+                    it->source = state.source.name;
+                    it->last_seen = now;
+                }
+            }
+            state.error.clear();
+        }
+        catch (const std::exception& e)
+        {
+            // a source that keeps failing is reported once, not every round
+            if (state.error != e.what())
+                errors.push_back(state.source.name + ": " + e.what());
+            state.error = e.what();
+        }
+        catch (...)
+        {
+            if (state.error != "Unknown error")
+                errors.push_back(state.source.name + ": Unknown error");
+            state.error = "Unknown error";
+        }
+        devices_changed = true;
+    }
+
+    if (devices_changed)
+    {
+        // only checked when a round lands, so a list that was not looked at for a while still shows what it had
+        auto forget_after = std::chrono::duration<float>(forget_after_seconds_);
+        devices_.erase(std::remove_if(devices_.begin(), devices_.end(), [&](const Device& device) { return now - device.last_seen > forget_after; }),
+                       devices_.end());
+        std::sort(devices_.begin(), devices_.end(),
+                  [](const Device& a, const Device& b)
+                  {
+                      if (a.name != b.name)
+                          return a.name < b.name;
+                      return a.connection_string < b.connection_string;
+                  });
+    }
+
+    auto refresh_interval = std::chrono::duration<float>(refresh_interval_seconds_);
+    if (auto_refresh_ && now - last_shown_ < refresh_interval && !IsDiscovering() && now - last_round_started_ >= refresh_interval)
+        Refresh();
+    return errors;
+}
+
+bool DeviceDiscovery::IsDiscovering() const
+{
+    return std::any_of(sources_.begin(), sources_.end(), [](const SourceState& state) { return state.round.valid(); });
+}
+
+std::vector<DeviceDiscovery::Source> ModuleDiscoverySources(const daq::InstancePtr& instance)
+{
+    std::vector<DeviceDiscovery::Source> sources;
+    for (const daq::ModulePtr& module : instance.getModuleManager().getModules())
+    {
+        daq::DictPtr<daq::IString, daq::IDeviceType> device_types = module.getAvailableDeviceTypes();
+        if (!device_types.assigned() || device_types.getCount() == 0)
+            continue;
+        sources.push_back({module.getModuleInfo().getName().toStdString(), [module]() { return ToFoundDevices(module.getAvailableDevices()); }});
+    }
+    return sources;
+}
+
+DeviceDiscovery::Source DeviceDiscoverySource(const daq::DevicePtr& device)
+{
+    return {device.getName().toStdString(), [device]() { return ToFoundDevices(device.getAvailableDevices()); }};
+}
+
+DeviceDiscovery::Source MockDiscoverySource(std::chrono::milliseconds delay)
+{
+    return {"Mock",
+            [delay]()
+            {
+                std::this_thread::sleep_for(delay);
+                return std::vector<DeviceDiscovery::FoundDevice>{
+                    {"Mock device 0", "daqref://device0"},
+                    {"Mock device 1", "daqref://device1"},
+                };
+            }};
+}
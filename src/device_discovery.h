@@ -0,0 +1,73 @@
+#pragma once
+#include <opendaq/opendaq.h>
+#include <string>
+#include <vector>
+#include <future>
+#include <functional>
+#include <chrono>
+
+
+// Finds devices in the background with one worker per source, usually one per protocol module. The results of each
+// source are merged into a deduplicated cache as soon as that source is done, so fast protocols show up without
+// waiting for slow ones, and devices that stop answering linger for a while with the time they were last seen.
+class DeviceDiscovery
+{
+public:
+    struct FoundDevice
+    {
+        std::string name;
+        std::string connection_string;
+    };
+    struct Source
+    {
+        std::string name;
+        std::function<std::vector<FoundDevice>()> discover; // called on a worker thread
+    };
+    struct Device
+    {
+        std::string name;
+        std::string connection_string;
+        std::string source;
+        std::chrono::steady_clock::time_point last_seen;
+    };
+    struct SourceState
+    {
+        Source source;
+        std::future<std::vector<FoundDevice>> round;
+        std::chrono::steady_clock::time_point round_started;
+        double last_latency_ms = -1.0;
+        std::string error;
+    };
+
+    explicit DeviceDiscovery(std::vector<Source> sources);
+
+    // Starts a round on every source that is not busy with one
+    void Refresh();
+    // Keeps auto refresh going, rounds only run while the list is being looked at
+    void MarkShown() { last_shown_ = std::chrono::steady_clock::now(); }
+    // Merges the sources that are done and starts the next round once the interval has passed. Devices not seen
+    // for forget_after_seconds_ are dropped when a round lands. Returns the errors of sources that started failing.
+    std::vector<std::string> Update();
+    bool IsDiscovering() const;
+
+    // sorted by name, then connection string
+    const std::vector<Device>& Devices() const { return devices_; }
+    const std::vector<SourceState>& Sources() const { return sources_; }
+
+    bool auto_refresh_ = true;
+    float refresh_interval_seconds_ = 5.0f;
+    float forget_after_seconds_ = 60.0f;
+
+private:
+    std::vector<SourceState> sources_;
+    std::vector<Device> devices_;
+    std::chrono::steady_clock::time_point last_round_started_;
+    std::chrono::steady_clock::time_point last_shown_;
+};
+
+// One source per loaded module that can connect to devices, i.e. one per protocol
+std::vector<DeviceDiscovery::Source> ModuleDiscoverySources(const daq::InstancePtr& instance);
+// Everything a (remote) device finds as a single source
+DeviceDiscovery::Source DeviceDiscoverySource(const daq::DevicePtr& device);
+// Fake devices reported after a delay, for trying out the device list without any hardware
+DeviceDiscovery::Source MockDiscoverySource(std::chrono::milliseconds delay);
@@ -0,0 +1,158 @@
+#include "function_block_catalog.h"
+#include "utils.h"
+#include <algorithm>
+#include <chrono>
+
+
+static std::vector<FunctionBlockCatalog::Type> ReadFunctionBlockTypes(daq::ComponentPtr parent)
+{
+    daq::DictPtr<daq::IString, daq::IFunctionBlockType> types;
+    if (canCastTo<daq::IInstance>(parent))
+        types = castTo<daq::IInstance>(parent).getAvailableFunctionBlockTypes();
+    else if (canCastTo<daq::IDevice>(parent))
+        types = castTo<daq::IDevice>(parent).getAvailableFunctionBlockTypes();
+    else if (canCastTo<daq::IFunctionBlock>(parent))
+        types = castTo<daq::IFunctionBlock>(parent).getAvailableFunctionBlockTypes();
+
+    std::vector<FunctionBlockCatalog::Type> type_list;
+    if (types.assigned())
+    {
+        for (const auto [type_id, type] : types)
+            type_list.push_back({type_id.toStdString(), type.getDescription().assigned() ? type.getDescription().toStdString() : ""});
+    }
+    return type_list;
+}
+
+const FunctionBlockCatalog::Entry& FunctionBlockCatalog::Request(const daq::ComponentPtr& parent)
+{
+    std::string parent_id = parent.getGlobalId().toStdString();
+    Entry& entry = entries_[parent_id];
+    if (!entry.is_current && !entry.load.valid() && !entry.is_queued)
+    {
+        entry.is_queued = true;
+        queued_loads_.emplace_back(std::move(parent_id), parent);
+        StartQueuedLoads();
+    }
+    return entry;
+}
+
+void FunctionBlockCatalog::StartQueuedLoads()
+{
+    while (running_loads_ < MAX_RUNNING_LOADS && !queued_loads_.empty())
+    {
+        std::string parent_id = std::move(queued_loads_.front().first);
+        daq::ComponentPtr parent = queued_loads_.front().second;
+        queued_loads_.pop_front();
+        auto it = entries_.find(parent_id);
+        if (it == entries_.end() || !it->second.is_queued)
+            continue;
+
+        Entry& entry = it->second;
+        entry.is_queued = false;
+        try
+        {
+            entry.load = std::async(std::launch::async, [parent]() { return ReadFunctionBlockTypes(parent); });
+            running_loads_++;
+        }
+        catch (const std::exception& e)
+        {
+            entry.error = e.what();
+            entry.is_current = true;
+            start_errors_.push_back(entry.error);
+            version_++;
+        }
+    }
+}
+
+std::vector<std::string> FunctionBlockCatalog::Poll()
+{
+    size_t abandoned_count = abandoned_loads_.size();
+    abandoned_loads_.erase(std::remove_if(abandoned_loads_.begin(), abandoned_loads_.end(),
+                                          [](const std::future<std::vector<Type>>& load)
+                                          { return load.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+                           abandoned_loads_.end());
+    running_loads_ -= abandoned_count - abandoned_loads_.size();
+
+    std::vector<std::string> errors = std::move(start_errors_);
+    start_errors_.clear();
+    for (auto& [parent_id, entry] : entries_)
+    {
+        if (!entry.load.valid() || entry.load.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            continue;
+
+        running_loads_--;
+
+        try
+        {
+            entry.types = entry.load.get();
+            entry.is_loaded = true;
+            entry.error.clear();
+        }
+        catch (const std::exception& e)
+        {
+            entry.error = e.what();
+            errors.push_back(entry.error);
+        }
+        catch (...)
+        {
+            entry.error = "Unknown error";
+            errors.push_back(entry.error);
+        }
+        entry.is_current = true;
+        version_++;
+    }
+    StartQueuedLoads();
+    return errors;
+}
+
+void FunctionBlockCatalog::InvalidateDevice(const std::string& device_id)
+{
+    for (auto it = entries_.begin(); it != entries_.end(); )
+    {
+        if (IsInSubtree(it->first, device_id))
+        {
+            if (it->second.load.valid())
+                abandoned_loads_.push_back(std::move(it->second.load));
+            it = entries_.erase(it);
+            continue;
+        }
+        if (IsInSubtree(device_id, it->first))
+            it->second.is_current = false;
+        ++it;
+    }
+    queued_loads_.erase(std::remove_if(queued_loads_.begin(), queued_loads_.end(),
+                                       [&](const auto& queued) { return IsInSubtree(queued.first, device_id); }),
+                        queued_loads_.end());
+    version_++;
+}
+
+FunctionBlockCatalog::Entry* FunctionBlockCatalog::LoadEntry(const std::string& parent_id)
+{
+    Entry& entry = entries_[parent_id];
+    entry.types.clear();
+    entry.is_loaded = true;
+    return &entry;
+}
+
+void FunctionBlockCatalog::SaveSettings(ImGuiTextBuffer* buf, const char* type_name) const
+{
+    for (const auto& [parent_id, entry] : entries_)
+    {
+        if (!entry.is_loaded)
+            continue;
+        buf->appendf("[%s][%s]\n", type_name, parent_id.c_str());
+        for (const Type& type : entry.types)
+        {
+            buf->appendf("Type=%s\n", type.id.c_str());
+            if (!type.description.empty())
+            {
+                // one line per field, so line breaks in the description are flattened
+                std::string description = type.description;
+                std::replace(description.begin(), description.end(), '\n', ' ');
+                std::replace(description.begin(), description.end(), '\r', ' ');
+                buf->appendf("Description=%s\n", description.c_str());
+            }
+        }
+        buf->append("\n");
+    }
+}
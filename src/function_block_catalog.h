@@ -0,0 +1,56 @@
+#pragma once
+#include <opendaq/opendaq.h>
+#include "imgui.h"
+#include <string>
+#include <vector>
+#include <future>
+#include <unordered_map>
+#include <deque>
+#include <cstdint>
+
+
+// The function block types that can be added under each parent, read on a worker and kept between sessions.
+// Lists loaded from the INI are shown right away and refreshed in the background the first time they are asked for.
+class FunctionBlockCatalog
+{
+public:
+    struct Type
+    {
+        std::string id;
+        std::string description;
+    };
+    struct Entry
+    {
+        std::vector<Type> types;
+        bool is_loaded = false;  // types hold a list, read in this run or the last one
+        bool is_current = false; // read in this run, or the read failed and is not retried until invalidated
+        std::string error;
+        std::future<std::vector<Type>> load;
+        bool is_queued = false; // waiting for a free worker
+    };
+
+    // Queues a background read of the parent's types unless they are current or already being read
+    const Entry& Request(const daq::ComponentPtr& parent);
+    // Takes in finished reads, returns the errors of the ones that failed
+    std::vector<std::string> Poll();
+    // Forgets the lists of a device and everything below it, and marks those of its ancestors for a refresh
+    void InvalidateDevice(const std::string& device_id);
+    // bumped whenever a read lands, so lists built from the catalog know to rebuild
+    uint64_t Version() const { return version_; }
+
+    Entry* LoadEntry(const std::string& parent_id);
+    void SaveSettings(ImGuiTextBuffer* buf, const char* type_name) const;
+
+private:
+    void StartQueuedLoads();
+
+    // opening a menu asks for every parent in the tree at once, so only a few of them are read at a time
+    static constexpr size_t MAX_RUNNING_LOADS = 4;
+
+    std::unordered_map<std::string, Entry> entries_;
+    std::deque<std::pair<std::string, daq::ComponentPtr>> queued_loads_;
+    std::vector<std::future<std::vector<Type>>> abandoned_loads_; // of forgotten entries, kept until they finish so nothing blocks
+    size_t running_loads_ = 0; // including the abandoned ones
+    std::vector<std::string> start_errors_;
+    uint64_t version_ = 0;
+};
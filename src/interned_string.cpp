@@ -0,0 +1,41 @@
+#include "interned_string.h"
+#include <unordered_set>
+#include <mutex>
+
+
+// properties are loaded on background threads too, so the table is shared behind a mutex;
+// unordered_set nodes never move, which keeps the handed out pointers valid
+static std::mutex s_table_mutex;
+static std::unordered_set<std::string> s_table;
+static std::size_t s_table_bytes = 0;
+
+static const std::string* Intern(const std::string& text)
+{
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    auto [it, inserted] = s_table.insert(text);
+    if (inserted)
+        s_table_bytes += sizeof(std::string) + (it->capacity() > 15 ? it->capacity() + 1 : 0);
+    return &*it;
+}
+
+InternedString::InternedString()
+{
+    static const std::string* empty = Intern("");
+    value_ = empty;
+}
+
+InternedString::InternedString(const std::string& text)
+    : value_(Intern(text))
+{
+}
+
+InternedString::InternedString(const char* text)
+    : value_(Intern(text))
+{
+}
+
+InternedString::TableStats InternedString::GetTableStats()
+{
+    std::lock_guard<std::mutex> lock(s_table_mutex);
+    return { s_table.size(), s_table_bytes };
+}
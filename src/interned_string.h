@@ -0,0 +1,43 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+
+// Handle to a string stored once in a process-wide table. Equal strings share the same storage,
+// so copies are a pointer copy and equality is a pointer comparison. Interned strings are never freed.
+class InternedString
+{
+public:
+    InternedString();
+    InternedString(const std::string& text);
+    InternedString(const char* text);
+
+    const std::string& str() const { return *value_; }
+    operator const std::string&() const { return *value_; }
+    const char* c_str() const { return value_->c_str(); }
+    bool empty() const { return value_->empty(); }
+    std::size_t size() const { return value_->size(); }
+    char operator[](std::size_t i) const { return (*value_)[i]; }
+
+    bool operator==(const InternedString& other) const { return value_ == other.value_; }
+    bool operator!=(const InternedString& other) const { return value_ != other.value_; }
+    bool operator==(const char* other) const { return *value_ == other; }
+    bool operator!=(const char* other) const { return *value_ != other; }
+    bool operator==(const std::string& other) const { return *value_ == other; }
+    bool operator!=(const std::string& other) const { return *value_ != other; }
+
+    struct TableStats
+    {
+        std::size_t strings = 0;
+        std::size_t bytes = 0;
+    };
+    static TableStats GetTableStats();
+
+private:
+    const std::string* value_;
+};
+
+inline std::string operator+(const InternedString& lhs, const std::string& rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const std::string& lhs, const InternedString& rhs) { return lhs + rhs.str(); }
+inline std::string operator+(const InternedString& lhs, const char* rhs) { return lhs.str() + rhs; }
+inline std::string operator+(const char* lhs, const InternedString& rhs) { return lhs + rhs.str(); }
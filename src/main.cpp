@@ -20,6 +20,7 @@ int main(int argc, char** argv)
 {
     std::string connection_string;
     bool light_mode = false;
+    bool mock_discovery = false;
     for (int i = 1; i < argc; i++)
     {
         std::string arg = argv[i];
@@ -39,12 +40,17 @@ int main(int argc, char** argv)
         {
             light_mode = true;
         }
+        else if (arg == "--mock-discovery")
+        {
+            mock_discovery = true;
+        }
         else if (arg == "--help" || arg == "-h")
         {
             printf("Usage: %s [options]\n", argv[0]);
             printf("Options:\n");
             printf("  --connection-string, -c <string>   Connect directly to a device (usually daq.nd://<ip>).\n");
             printf("  --light-mode                       Use light theme instead of dark theme.\n");
+            printf("  --mock-discovery                   List fake discovered devices, for trying out the device list.\n");
             printf("  --version, -v                      Display program and openDAQ version.\n");
             printf("  --help, -h                         Show this help message.\n");
             return 0;
@@ -64,6 +70,7 @@ int main(int argc, char** argv)
     }
 
     OpenDAQNodeEditor opendaq_editor;
+    opendaq_editor.use_mock_discovery_ = mock_discovery;
     opendaq_editor.Init();
     
     if (connection_string == "demo")
@@ -85,7 +92,7 @@ int main(int argc, char** argv)
     }
     else if (!connection_string.empty())
     {
-        opendaq_editor.instance_.addDevice(connection_string);
+        opendaq_editor.AddStartupDevice(connection_string);
     }
 
     const char* glsl_version = "#version 150";
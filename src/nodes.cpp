@@ -144,7 +144,7 @@ void ImGuiNodes::SetSelectedNodes(const std::vector<ImGuiNodesUid>& selected_ids
         if (auto it = nodes_by_uid_.find(id); it != nodes_by_uid_.end())
             SET_FLAG(it->second->state_, ImGuiNodesNodeStateFlag_Selected);
         else if (auto it = inputs_by_uid_.find(id); it != inputs_by_uid_.end())
-            SET_FLAG(it->second->state_, ImGuiNodesConnectorStateFlag_Selected);
+            SET_FLAG(it->second.input->state_, ImGuiNodesConnectorStateFlag_Selected);
         else if (auto it = outputs_by_uid_.find(id); it != outputs_by_uid_.end())
             SET_FLAG(it->second.output->state_, ImGuiNodesConnectorStateFlag_Selected);
     }
@@ -524,6 +524,12 @@ void ImGuiNodes::AddNode(const ImGuiNodesIdentifier& name, ImColor color,
                          const std::vector<ImGuiNodesIdentifier>& outputs,
                          ImGuiNodesUid parent_uid)
 {
+    if (auto it = nodes_by_uid_.find(name.id_); it != nodes_by_uid_.end() && IS_SET(it->second->state_, ImGuiNodesNodeStateFlag_Stale))
+    {
+        ReviveStaleNode(it->second, name, color, inputs, outputs, parent_uid);
+        return;
+    }
+
     ImVec2 pos(0.0f, 0.0f);
 
     if (auto it = node_cache_.find(name.id_); it != node_cache_.end())
@@ -632,7 +638,7 @@ void ImGuiNodes::AddNode(const ImGuiNodesIdentifier& name, ImColor color, ImVec2
     nodes_by_uid_[node->uid_] = node;
     
     for (size_t input_idx = 0; input_idx < node->inputs_.size(); ++input_idx)
-        inputs_by_uid_[node->inputs_[input_idx].uid_] = &node->inputs_[input_idx];
+        inputs_by_uid_[node->inputs_[input_idx].uid_] = {&node->inputs_[input_idx], node};
     
     for (size_t output_idx = 0; output_idx < node->outputs_.size(); ++output_idx)
         outputs_by_uid_[node->outputs_[output_idx].uid_] = {&node->outputs_[output_idx], node};
@@ -723,7 +729,7 @@ void ImGuiNodes::Update()
             if (outputs_by_uid_.count(rebuild_cache_.active_output_uid_)) active_output_ = outputs_by_uid_[rebuild_cache_.active_output_uid_].output;
 
         if (active_input_ == NULL && !rebuild_cache_.active_input_uid_.empty())
-            if (inputs_by_uid_.count(rebuild_cache_.active_input_uid_)) active_input_ = inputs_by_uid_[rebuild_cache_.active_input_uid_];
+            if (inputs_by_uid_.count(rebuild_cache_.active_input_uid_)) active_input_ = inputs_by_uid_[rebuild_cache_.active_input_uid_].input;
 
         if (state_ == ImGuiNodesState_DraggingOutput && active_output_ == NULL) state_ = ImGuiNodesState_Default;
         if (state_ == ImGuiNodesState_DraggingInput && active_input_ == NULL) state_ = ImGuiNodesState_Default;
@@ -1469,23 +1475,6 @@ void ImGuiNodes::DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete
     for (ImGuiNodesNode* node : nodes_to_delete)
         node->CollectEmbeddedDescendants(expanded_delete_list);
 
-    // Remove deleted embedded children from surviving parents' embedded_children_ lists
-    // and collect parents that need geometry rebuild
-    std::vector<ImGuiNodesNode*> parents_to_rebuild;
-    for (ImGuiNodesNode* node : expanded_delete_list)
-    {
-        if (node->is_embedded_ && node->parent_node_)
-        {
-            // Only clean up if the parent is NOT also being deleted
-            if (std::find(expanded_delete_list.begin(), expanded_delete_list.end(), node->parent_node_) == expanded_delete_list.end())
-            {
-                auto& siblings = node->parent_node_->embedded_children_;
-                siblings.erase(std::remove(siblings.begin(), siblings.end(), node), siblings.end());
-                parents_to_rebuild.push_back(node->parent_node_->GetEmbeddingRoot());
-            }
-        }
-    }
-
     for (int node_idx = 0; node_idx < nodes_.size(); ++node_idx)
     {
         ImGuiNodesNode* node = nodes_[node_idx];
@@ -1501,12 +1490,108 @@ void ImGuiNodes::DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete
     }
 
     std::vector<ImGuiNodesUid> deleted_nodes_uids;
-    if (callbacks.on_node_delete)
+    for (ImGuiNodesNode* node : expanded_delete_list)
     {
-        for (ImGuiNodesNode* node : expanded_delete_list)
+        node_cache_[node->uid_] = { node->area_node_.GetCenter(), node->color_, true, "" };
+        if (callbacks.on_node_delete)
             deleted_nodes_uids.push_back(node->uid_);
     }
 
+    DestroyNodes(expanded_delete_list);
+
+    if (callbacks.on_node_delete)
+        callbacks.on_node_delete(deleted_nodes_uids);
+}
+
+std::vector<ImGuiNodesUid> ImGuiNodes::RemoveNodes(const std::vector<ImGuiNodesUid>& uids)
+{
+    std::vector<ImGuiNodesNode*> nodes_to_remove;
+    for (const ImGuiNodesUid& uid : uids)
+    {
+        if (auto it = nodes_by_uid_.find(uid); it != nodes_by_uid_.end())
+            nodes_to_remove.push_back(it->second);
+    }
+
+    // remembered the same way Clear does, so nodes that are added again come back where they were
+    auto remember = [&](ImGuiNodesNode* node)
+    {
+        bool selected = IS_SET(node->state_, ImGuiNodesNodeStateFlag_Selected);
+        ImGuiNodesUid embed_parent = (node->is_embedded_ && node->parent_node_) ? node->parent_node_->uid_ : "";
+        node_cache_[node->uid_] = { node->area_node_.GetCenter(), node->color_, selected, embed_parent };
+    };
+    for (ImGuiNodesNode* node : nodes_to_remove)
+        remember(node);
+
+    // nodes embedded into a removed one but not removed themselves are only unembedded,
+    // RestoreCachedEmbedding puts them back once their host has been added again
+    std::vector<ImGuiNodesUid> unembedded_uids;
+    for (ImGuiNodesNode* node : nodes_to_remove)
+    {
+        std::vector<ImGuiNodesNode*> embedded_children = node->embedded_children_;
+        for (ImGuiNodesNode* child : embedded_children)
+        {
+            if (std::find(nodes_to_remove.begin(), nodes_to_remove.end(), child) != nodes_to_remove.end())
+                continue;
+            remember(child);
+            UnembedNode(child->uid_);
+            child->parent_node_ = nullptr;
+            unembedded_uids.push_back(child->uid_);
+        }
+    }
+
+    DestroyNodes(nodes_to_remove);
+    return unembedded_uids;
+}
+
+void ImGuiNodes::RestoreCachedEmbedding(const std::vector<ImGuiNodesUid>& uids)
+{
+    // First pass: unembed nodes that the user had unembedded (cache says no parent, but topology embedded them)
+    for (const ImGuiNodesUid& uid : uids)
+    {
+        auto entry = node_cache_.find(uid);
+        if (entry != node_cache_.end() && entry->second.embedded_parent_uid.empty())
+        {
+            auto it = nodes_by_uid_.find(uid);
+            if (it != nodes_by_uid_.end() && it->second->is_embedded_)
+                UnembedNode(uid);
+        }
+    }
+
+    // Second pass: embed nodes that the user had embedded (cache says parent, but topology didn't embed them)
+    for (const ImGuiNodesUid& uid : uids)
+    {
+        auto entry = node_cache_.find(uid);
+        if (entry != node_cache_.end() && !entry->second.embedded_parent_uid.empty())
+        {
+            auto it = nodes_by_uid_.find(uid);
+            if (it != nodes_by_uid_.end() && !it->second->is_embedded_)
+            {
+                if (nodes_by_uid_.find(entry->second.embedded_parent_uid) != nodes_by_uid_.end())
+                    EmbedNode(uid, entry->second.embedded_parent_uid);
+            }
+        }
+    }
+}
+
+void ImGuiNodes::DestroyNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete)
+{
+    // Remove deleted embedded children from surviving parents' embedded_children_ lists
+    // and collect parents that need geometry rebuild
+    std::vector<ImGuiNodesNode*> parents_to_rebuild;
+    for (ImGuiNodesNode* node : nodes_to_delete)
+    {
+        if (node->is_embedded_ && node->parent_node_)
+        {
+            // Only clean up if the parent is NOT also being deleted
+            if (std::find(nodes_to_delete.begin(), nodes_to_delete.end(), node->parent_node_) == nodes_to_delete.end())
+            {
+                auto& siblings = node->parent_node_->embedded_children_;
+                siblings.erase(std::remove(siblings.begin(), siblings.end(), node), siblings.end());
+                parents_to_rebuild.push_back(node->parent_node_->GetEmbeddingRoot());
+            }
+        }
+    }
+
     ImVector<ImGuiNodesNode*> non_removed_nodes;
     non_removed_nodes.reserve(nodes_.size());
 
@@ -1515,10 +1600,8 @@ void ImGuiNodes::DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete
         ImGuiNodesNode* node = nodes_[node_idx];
         IM_ASSERT(node);
 
-        if (std::find(expanded_delete_list.begin(), expanded_delete_list.end(), node) != expanded_delete_list.end())
+        if (std::find(nodes_to_delete.begin(), nodes_to_delete.end(), node) != nodes_to_delete.end())
         {
-            node_cache_[node->uid_] = { node->area_node_.GetCenter(), node->color_, true, "" };
-
             active_node_ = NULL;
             active_input_ = NULL;
             active_output_ = NULL;
@@ -1563,6 +1646,13 @@ void ImGuiNodes::DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete
         }			
     }
 
+    // children of a removed node that stay (not embedded into it) would otherwise point at freed memory
+    for (int node_idx = 0; node_idx < non_removed_nodes.size(); ++node_idx)
+    {
+        if (std::find(nodes_to_delete.begin(), nodes_to_delete.end(), non_removed_nodes[node_idx]->parent_node_) != nodes_to_delete.end())
+            non_removed_nodes[node_idx]->parent_node_ = nullptr;
+    }
+
     nodes_ = non_removed_nodes;
 
     // Rebuild geometry for surviving parents whose embedded children were deleted
@@ -1571,9 +1661,6 @@ void ImGuiNodes::DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete
         if (std::find(non_removed_nodes.begin(), non_removed_nodes.end(), parent) != non_removed_nodes.end())
             RebuildEmbeddedGeometry(parent);
     }
-
-    if (callbacks.on_node_delete)
-        callbacks.on_node_delete(deleted_nodes_uids);
 }
 
 void ImGuiNodes::ProcessNodes()
@@ -2044,6 +2131,12 @@ void ImGuiNodesNode::Render(ImDrawList* draw_list, ImVec2 offset, float scale, I
         head_color = ImColor(0.3f, 0.3f, 0.3f, 0.5f);
     }
 
+    if (IS_SET(state_, ImGuiNodesNodeStateFlag_Stale))
+    {
+        body_color.Value.w = 0.35f;
+        head_color.Value.w *= 0.5f;
+    }
+
     const ImVec2 outline(3.0f * scale, 3.0f * scale);
 
     if (IS_SET(state_, ImGuiNodesNodeStateFlag_Disabled))
@@ -2249,6 +2342,131 @@ void ImGuiNodes::SetActive(const ImGuiNodesUid& uid, bool active)
     }
 }
 
+void ImGuiNodes::SetStale(const ImGuiNodesUid& uid, bool stale)
+{
+    if (auto it = nodes_by_uid_.find(uid); it != nodes_by_uid_.end())
+    {
+        if (stale)
+            SET_FLAG(it->second->state_, ImGuiNodesNodeStateFlag_Stale);
+        else
+            CLEAR_FLAG(it->second->state_, ImGuiNodesNodeStateFlag_Stale);
+    }
+}
+
+std::vector<ImGuiNodesUid> ImGuiNodes::GetStaleNodes() const
+{
+    std::vector<ImGuiNodesUid> uids;
+    for (const ImGuiNodesNode* node : nodes_)
+    {
+        if (IS_SET(node->state_, ImGuiNodesNodeStateFlag_Stale))
+            uids.push_back(node->uid_);
+    }
+    return uids;
+}
+
+void ImGuiNodes::ReviveStaleNode(ImGuiNodesNode* node, const ImGuiNodesIdentifier& name, ImColor color,
+                                 const std::vector<ImGuiNodesIdentifier>& inputs,
+                                 const std::vector<ImGuiNodesIdentifier>& outputs,
+                                 ImGuiNodesUid parent_uid)
+{
+    CLEAR_FLAG(node->state_, ImGuiNodesNodeStateFlag_Stale);
+    node->name_ = name.name_;
+    node->color_ = color;
+    if (!node->is_embedded_)
+    {
+        auto parent_it = nodes_by_uid_.find(parent_uid);
+        node->parent_node_ = parent_it != nodes_by_uid_.end() ? parent_it->second : NULL;
+    }
+
+    // the saved connections into the node are dropped, the caller adds the live ones back once the subtree is in
+    for (auto& input : node->inputs_)
+        RemoveConnection(input.uid_);
+
+    auto same_connectors = [](const auto& connectors, const std::vector<ImGuiNodesIdentifier>& identifiers)
+    {
+        if (connectors.size() != identifiers.size())
+            return false;
+        for (size_t idx = 0; idx < connectors.size(); ++idx)
+        {
+            if (connectors[idx].uid_ != identifiers[idx].id_ || connectors[idx].name_ != identifiers[idx].name_)
+                return false;
+        }
+        return true;
+    };
+    if (!same_connectors(node->inputs_, inputs) || !same_connectors(node->outputs_, outputs))
+    {
+        for (ImGuiNodesNode* other : nodes_)
+        {
+            for (auto& input : other->inputs_)
+            {
+                if (input.source_node_ == node)
+                    RemoveConnection(input.uid_);
+            }
+        }
+        for (const auto& input : node->inputs_)
+            inputs_by_uid_.erase(input.uid_);
+        for (const auto& output : node->outputs_)
+            outputs_by_uid_.erase(output.uid_);
+        active_input_ = NULL;
+        active_output_ = NULL;
+
+        node->inputs_.clear();
+        node->outputs_.clear();
+        for (const auto& input : inputs)
+            node->inputs_.push_back(ImGuiNodesInput(input));
+        for (const auto& output : outputs)
+            node->outputs_.push_back(ImGuiNodesOutput(output));
+        for (auto& input : node->inputs_)
+            inputs_by_uid_[input.uid_] = {&input, node};
+        for (auto& output : node->outputs_)
+            outputs_by_uid_[output.uid_] = {&output, node};
+    }
+
+    if (node->is_embedded_ || !node->embedded_children_.empty())
+    {
+        RebuildEmbeddedGeometry(node->GetEmbeddingRoot());
+    }
+    else
+    {
+        ImVec2 center = node->area_node_.GetCenter();
+        RebuildSingleNodeGeometry(node);
+        node->TranslateNode(center - node->area_node_.GetCenter(), false, false);
+    }
+}
+
+void ImGuiNodes::RenameItem(const ImGuiNodesUid& uid, const std::string& name)
+{
+    ImGuiNodesNode* owner = nullptr;
+    if (auto it = nodes_by_uid_.find(uid); it != nodes_by_uid_.end())
+    {
+        owner = it->second;
+        owner->name_ = name;
+    }
+    else if (auto it = outputs_by_uid_.find(uid); it != outputs_by_uid_.end())
+    {
+        owner = it->second.node;
+        it->second.output->name_ = name;
+    }
+    else if (auto it = inputs_by_uid_.find(uid); it != inputs_by_uid_.end())
+    {
+        owner = it->second.node;
+        it->second.input->name_ = name;
+    }
+    if (!owner)
+        return;
+
+    if (owner->is_embedded_ || !owner->embedded_children_.empty())
+    {
+        RebuildEmbeddedGeometry(owner->GetEmbeddingRoot());
+    }
+    else
+    {
+        ImVec2 center = owner->area_node_.GetCenter();
+        RebuildSingleNodeGeometry(owner);
+        owner->TranslateNode(center - owner->area_node_.GetCenter(), false, false);
+    }
+}
+
 void ImGuiNodes::ClearNodeConnections(const ImGuiNodesUid& node_uid)
 {
     if (auto it = nodes_by_uid_.find(node_uid); it != nodes_by_uid_.end())
@@ -2564,7 +2782,7 @@ void ImGuiNodes::AddConnection(const ImGuiNodesUid& output_uid, const ImGuiNodes
     
     if (input_it != inputs_by_uid_.end() && output_it != outputs_by_uid_.end())
     {
-        ImGuiNodesInput* input = input_it->second;
+        ImGuiNodesInput* input = input_it->second.input;
         ImGuiNodesOutput* output = output_it->second.output;
         ImGuiNodesNode* source_node = output_it->second.node;
         
@@ -2582,7 +2800,7 @@ void ImGuiNodes::SetConnectionColor(const ImGuiNodesUid& input_uid, std::optiona
 {
     if (auto input_it = inputs_by_uid_.find(input_uid); input_it != inputs_by_uid_.end())
     {
-        ImGuiNodesInput* input = input_it->second;
+        ImGuiNodesInput* input = input_it->second.input;
         input->connection_color_ = color;
     }
 }
@@ -2591,7 +2809,7 @@ void ImGuiNodes::RemoveConnection(const ImGuiNodesUid& input_uid)
 {
     if (auto input_it = inputs_by_uid_.find(input_uid); input_it != inputs_by_uid_.end())
     {
-        ImGuiNodesInput* input = input_it->second;
+        ImGuiNodesInput* input = input_it->second.input;
 
         if (input->source_output_)
             input->source_output_->connections_count_--;
@@ -2687,30 +2905,11 @@ void ImGuiNodes::EndBatchAdd()
     // Restore cached embedding state: apply user embed/unembed overrides
     if (!node_cache_.empty())
     {
-        // First pass: unembed nodes that the user had unembedded (cache says no parent, but topology embedded them)
+        std::vector<ImGuiNodesUid> cached_uids;
+        cached_uids.reserve(node_cache_.size());
         for (const auto& [uid, entry] : node_cache_)
-        {
-            if (entry.embedded_parent_uid.empty())
-            {
-                auto it = nodes_by_uid_.find(uid);
-                if (it != nodes_by_uid_.end() && it->second->is_embedded_)
-                    UnembedNode(uid);
-            }
-        }
-
-        // Second pass: embed nodes that the user had embedded (cache says parent, but topology didn't embed them)
-        for (const auto& [uid, entry] : node_cache_)
-        {
-            if (!entry.embedded_parent_uid.empty())
-            {
-                auto it = nodes_by_uid_.find(uid);
-                if (it != nodes_by_uid_.end() && !it->second->is_embedded_)
-                {
-                    if (nodes_by_uid_.find(entry.embedded_parent_uid) != nodes_by_uid_.end())
-                        EmbedNode(uid, entry.embedded_parent_uid);
-                }
-            }
-        }
+            cached_uids.push_back(uid);
+        RestoreCachedEmbedding(cached_uids);
     }
 
     std::unordered_map<ImGuiNodesUid, std::vector<ImGuiNodesNode*>> children_map;
@@ -3011,6 +3210,8 @@ void ImGuiNodes::RenderMinimap(ImDrawList* draw_list)
         color.Value.w = 0.8f;
         if (IS_SET(node->state_, ImGuiNodesNodeStateFlag_Inactive))
             color = ImColor(0.5f, 0.5f, 0.5f);
+        if (IS_SET(node->state_, ImGuiNodesNodeStateFlag_Stale))
+            color.Value.w = 0.35f;
         if (IS_SET(node->state_, ImGuiNodesNodeStateFlag_Selected))
         {
             if (UsingImGuiLightStyle())
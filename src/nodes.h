@@ -35,7 +35,8 @@ enum ImGuiNodesNodeStateFlag_
     ImGuiNodesNodeStateFlag_Disabled             = 1 << 5,
     ImGuiNodesNodeStateFlag_Warning              = 1 << 6,
     ImGuiNodesNodeStateFlag_Error                = 1 << 7,
-    ImGuiNodesNodeStateFlag_Inactive             = 1 << 8
+    ImGuiNodesNodeStateFlag_Inactive             = 1 << 8,
+    ImGuiNodesNodeStateFlag_Stale                = 1 << 9   // placeholder from a saved topology, not read from the device yet
 };
 
 enum ImGuiNodesState_
@@ -202,12 +203,22 @@ public:
     void SetError(const ImGuiNodesUid& uid, const std::string& message);
     void SetOk(const ImGuiNodesUid& uid);
     void SetActive(const ImGuiNodesUid& uid, bool active);
+    // Stale nodes are taken over in place by AddNode with the same uid, keeping their position, embedding and children
+    void SetStale(const ImGuiNodesUid& uid, bool stale);
+    std::vector<ImGuiNodesUid> GetStaleNodes() const;
+    // Renames a node, input or output and resizes the node that shows it
+    void RenameItem(const ImGuiNodesUid& uid, const std::string& name);
     void SetSelectedNodes(const std::vector<ImGuiNodesUid>& selected_ids);
     void MoveSelectedNodesIntoView();
     void ClearNodeConnections(const ImGuiNodesUid& node_uid);
     bool HasNode(const ImGuiNodesUid& uid) const;
     void EmbedNode(const ImGuiNodesUid& child_uid, const ImGuiNodesUid& parent_uid);
     void UnembedNode(const ImGuiNodesUid& child_uid);
+    // Removes nodes without notifying on_node_delete, remembering their layout for when they are added again.
+    // Returns the nodes that were embedded into a removed one and got unembedded instead of removed.
+    std::vector<ImGuiNodesUid> RemoveNodes(const std::vector<ImGuiNodesUid>& uids);
+    // Re-applies the user's embed/unembed choices remembered for these nodes
+    void RestoreCachedEmbedding(const std::vector<ImGuiNodesUid>& uids);
     void Clear();
     void RebuildGeometry();
 
@@ -247,6 +258,12 @@ private:
         bool needs_rebuild_ = false;
     } rebuild_cache_;
 
+    struct InputWithOwner
+    {
+        ImGuiNodesInput* input;
+        ImGuiNodesNode* node;
+    };
+
     struct OutputWithOwner
     {
         ImGuiNodesOutput* output;
@@ -255,7 +272,7 @@ private:
 
     ImVector<ImGuiNodesNode*> nodes_;
     std::unordered_map<ImGuiNodesUid, ImGuiNodesNode*> nodes_by_uid_;
-    std::unordered_map<ImGuiNodesUid, ImGuiNodesInput*> inputs_by_uid_;
+    std::unordered_map<ImGuiNodesUid, InputWithOwner> inputs_by_uid_;
     std::unordered_map<ImGuiNodesUid, OutputWithOwner> outputs_by_uid_;
 
     // cache for node positions and colors between deletions
@@ -272,6 +289,7 @@ private:
     void ProcessInteractions();
     void ProcessNodes();
     void DeleteNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete);
+    void DestroyNodes(const std::vector<ImGuiNodesNode*>& nodes_to_delete);
     void UpdateCanvasGeometry(ImDrawList* draw_list);
     ImGuiNodesNode* UpdateNodesFromCanvas();
     void RenderConnection(ImVec2 p1, ImVec2 p4, ImColor color, float thickness = 1.5f);
@@ -280,6 +298,10 @@ private:
     void ClearAllConnectorSelections();
     ImVec2 UpdateEdgeScrolling();
     void RebuildSingleNodeGeometry(ImGuiNodesNode* node, float min_width = 0.0f);
+    void ReviveStaleNode(ImGuiNodesNode* node, const ImGuiNodesIdentifier& name, ImColor color,
+                         const std::vector<ImGuiNodesIdentifier>& inputs,
+                         const std::vector<ImGuiNodesIdentifier>& outputs,
+                         ImGuiNodesUid parent_uid);
     void RebuildEmbeddedGeometry(ImGuiNodesNode* parent);
 };
 
@@ -0,0 +1,58 @@
+#include "notification_aggregator.h"
+#include "utils.h"
+#include "ImGuiNotify.hpp"
+#include <algorithm>
+
+
+NotificationAggregator::NotificationAggregator(const std::string& what, double window_seconds)
+    : what_(what)
+    , window_(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(window_seconds)))
+{
+}
+
+void NotificationAggregator::Post(bool is_error, const std::string& text)
+{
+    Update();
+    if (!window_open_)
+    {
+        Show(is_error, text);
+        window_start_ = std::chrono::steady_clock::now();
+        window_open_ = true;
+        return;
+    }
+
+    pending_count_++;
+    pending_is_error_ |= is_error;
+    pending_text_ = text;
+}
+
+void NotificationAggregator::Update()
+{
+    if (!window_open_ || std::chrono::steady_clock::now() - window_start_ < window_)
+        return;
+
+    window_open_ = false;
+    if (pending_count_ == 0)
+        return;
+
+    if (pending_count_ == 1)
+    {
+        Show(pending_is_error_, pending_text_);
+    }
+    else
+    {
+        double seconds = std::chrono::duration<double>(window_).count();
+        Show(pending_is_error_, std::to_string(pending_count_) + " " + what_ + " in " + std::to_string((int)std::max(1.0, seconds)) + " s, latest: " + pending_text_);
+    }
+    // the summary opens a new window, so a steady flood produces at most one toast per window
+    window_start_ = std::chrono::steady_clock::now();
+    window_open_ = true;
+    pending_count_ = 0;
+    pending_is_error_ = false;
+    pending_text_.clear();
+}
+
+void NotificationAggregator::Show(bool is_error, const std::string& text)
+{
+    ImGui::InsertNotification({is_error ? ImGuiToastType::Error : ImGuiToastType::Warning, DEFAULT_NOTIFICATION_DURATION_MS, "%s", text.c_str()});
+}
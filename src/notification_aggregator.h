@@ -0,0 +1,27 @@
+#pragma once
+#include <string>
+#include <chrono>
+
+
+// Rate limits a stream of similar toasts. The first one in a window is shown right away, everything posted
+// during the rest of the window is reported as a single "N <what> in 1 s" toast once the window has passed.
+class NotificationAggregator
+{
+public:
+    explicit NotificationAggregator(const std::string& what, double window_seconds = 1.0);
+
+    void Post(bool is_error, const std::string& text);
+    // Emits the summary of a finished window, called once per frame
+    void Update();
+
+private:
+    void Show(bool is_error, const std::string& text);
+
+    std::string what_;
+    std::chrono::steady_clock::duration window_;
+    std::chrono::steady_clock::time_point window_start_;
+    bool window_open_ = false;
+    int pending_count_ = 0;
+    bool pending_is_error_ = false;
+    std::string pending_text_; // the latest one, shown as is when it is the only pending toast
+};
@@ -10,11 +10,21 @@
 #include <cstdlib>
 #include <ctime>
 #include <chrono>
+#include <unordered_set>
 
 
 OpenDAQNodeEditor::OpenDAQNodeEditor()
     : instance_(daq::Instance("."))
 {
+    CachedComponent::abandoned_property_loads_ = &abandoned_property_loads_;
+}
+
+OpenDAQNodeEditor::~OpenDAQNodeEditor()
+{
+    // dropping the components cancels their loads, which are then waited for while the instance they read is alive
+    all_components_.clear();
+    abandoned_property_loads_.clear();
+    CachedComponent::abandoned_property_loads_ = nullptr;
 }
 
 #include "imgui_internal.h"
@@ -185,6 +195,106 @@ static void ClonedWindowsSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHa
     }
 }
 
+static void* TopologySnapshotSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler*, const char* name)
+{
+    return (void*)name;
+}
+
+// splits "a,b,rest" into at most count fields, the last one keeps any further commas
+static std::vector<std::string> SplitSnapshotFields(const char* text, std::size_t count)
+{
+    std::vector<std::string> fields;
+    std::string rest = text;
+    while (fields.size() + 1 < count)
+    {
+        std::size_t comma = rest.find(',');
+        if (comma == std::string::npos)
+            break;
+        fields.push_back(rest.substr(0, comma));
+        rest.erase(0, comma + 1);
+    }
+    fields.push_back(rest);
+    return fields;
+}
+
+static void TopologySnapshotSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler* handler, void* /*entry*/, const char* line)
+{
+    OpenDAQNodeEditor* editor = (OpenDAQNodeEditor*)handler->UserData;
+    OpenDAQNodeEditor::TopologySnapshot& snapshot = editor->topology_snapshot_;
+    if (strncmp(line, "Connection=", 11) == 0)
+    {
+        snapshot.connection_string = line + 11;
+    }
+    else if (strncmp(line, "Node=", 5) == 0)
+    {
+        std::vector<std::string> fields = SplitSnapshotFields(line + 5, 4);
+        if (fields.size() == 4)
+            snapshot.nodes.push_back({fields[0], fields[1], fields[3], atoi(fields[2].c_str()), {}, {}});
+    }
+    else if (strncmp(line, "Input=", 6) == 0 || strncmp(line, "Output=", 7) == 0)
+    {
+        bool is_input = line[0] == 'I';
+        std::vector<std::string> fields = SplitSnapshotFields(strchr(line, '=') + 1, 2);
+        if (fields.size() == 2 && !snapshot.nodes.empty())
+            (is_input ? snapshot.nodes.back().inputs : snapshot.nodes.back().outputs).push_back({fields[1], fields[0]});
+    }
+    else if (strncmp(line, "Connect=", 8) == 0)
+    {
+        std::vector<std::string> fields = SplitSnapshotFields(line + 8, 2);
+        if (fields.size() == 2)
+            snapshot.connections.push_back({fields[0], fields[1]});
+    }
+}
+
+static void TopologySnapshotSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    OpenDAQNodeEditor* editor = (OpenDAQNodeEditor*)handler->UserData;
+    // only worth keeping for a device that is connected again on the next start
+    if (editor->startup_connection_string_.empty())
+        return;
+
+    // until the live topology has settled, the one loaded at startup is still the better guess
+    OpenDAQNodeEditor::TopologySnapshot snapshot = editor->showing_topology_snapshot_ ? editor->topology_snapshot_ : editor->TakeTopologySnapshot();
+    if (snapshot.nodes.empty())
+        return;
+
+    buf->appendf("[%s][Last]\n", handler->TypeName);
+    buf->appendf("Connection=%s\n", editor->startup_connection_string_.c_str());
+    for (const auto& node : snapshot.nodes)
+    {
+        buf->appendf("Node=%s,%s,%d,%s\n", node.id.c_str(), node.parent_id.c_str(), node.color_index, node.name.c_str());
+        for (const auto& input : node.inputs)
+            buf->appendf("Input=%s,%s\n", input.id_.c_str(), input.name_.c_str());
+        for (const auto& output : node.outputs)
+            buf->appendf("Output=%s,%s\n", output.id_.c_str(), output.name_.c_str());
+    }
+    for (const auto& [signal_id, input_id] : snapshot.connections)
+        buf->appendf("Connect=%s,%s\n", signal_id.c_str(), input_id.c_str());
+    buf->append("\n");
+}
+
+static void* FunctionBlockTypesSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSettingsHandler* handler, const char* name)
+{
+    OpenDAQNodeEditor* editor = (OpenDAQNodeEditor*)handler->UserData;
+    return (void*)editor->function_block_catalog_.LoadEntry(name);
+}
+
+static void FunctionBlockTypesSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line)
+{
+    auto& types = ((FunctionBlockCatalog::Entry*)entry)->types;
+    char text[1024];
+    if (sscanf(line, "Type=%1023[^\n]", text) == 1)
+        types.push_back({text, ""});
+    else if (sscanf(line, "Description=%1023[^\n]", text) == 1 && !types.empty())
+        types.back().description = text;
+}
+
+static void FunctionBlockTypesSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
+{
+    OpenDAQNodeEditor* editor = (OpenDAQNodeEditor*)handler->UserData;
+    editor->function_block_catalog_.SaveSettings(buf, handler->TypeName);
+}
+
 void OpenDAQNodeEditor::InitImGui()
 {
     ImGuiSettingsHandler ini_handler;
@@ -239,6 +349,24 @@ void OpenDAQNodeEditor::InitImGui()
     ini_handler6.WriteAllFn = ClonedWindowsSettingsHandler_WriteAll;
     ini_handler6.UserData = this;
     ImGui::GetCurrentContext()->SettingsHandlers.push_back(ini_handler6);
+
+    ImGuiSettingsHandler ini_handler7;
+    ini_handler7.TypeName = "TopologySnapshot";
+    ini_handler7.TypeHash = ImHashStr("TopologySnapshot");
+    ini_handler7.ReadOpenFn = TopologySnapshotSettingsHandler_ReadOpen;
+    ini_handler7.ReadLineFn = TopologySnapshotSettingsHandler_ReadLine;
+    ini_handler7.WriteAllFn = TopologySnapshotSettingsHandler_WriteAll;
+    ini_handler7.UserData = this;
+    ImGui::GetCurrentContext()->SettingsHandlers.push_back(ini_handler7);
+
+    ImGuiSettingsHandler ini_handler8;
+    ini_handler8.TypeName = "FunctionBlockTypes";
+    ini_handler8.TypeHash = ImHashStr("FunctionBlockTypes");
+    ini_handler8.ReadOpenFn = FunctionBlockTypesSettingsHandler_ReadOpen;
+    ini_handler8.ReadLineFn = FunctionBlockTypesSettingsHandler_ReadLine;
+    ini_handler8.WriteAllFn = FunctionBlockTypesSettingsHandler_WriteAll;
+    ini_handler8.UserData = this;
+    ImGui::GetCurrentContext()->SettingsHandlers.push_back(ini_handler8);
 }
 
 void OpenDAQNodeEditor::Init()
@@ -301,6 +429,9 @@ void OpenDAQNodeEditor::Init()
             OnSelectionChanged(ids);
         };
 
+    properties_window_.components_by_handle_ = &components_by_handle_;
+    properties_window_.property_writes_ = &property_writes_;
+    properties_window_.core_event_stats_ = &core_event_stats_;
     properties_window_.on_property_changed_ =
         [this](const std::string& component_id, const std::string& property_name)
         {
@@ -333,6 +464,7 @@ void OpenDAQNodeEditor::Init()
                     component->UpdateState(); // refresh the Locked state because there is no core event for that one
             }
         };
+    property_writes_.on_property_changed_ = properties_window_.on_property_changed_;
 }
 
 void OpenDAQNodeEditor::UpdateSignalsActiveState(CachedComponent* cached)
@@ -351,73 +483,139 @@ void OpenDAQNodeEditor::UpdateSignalsActiveState(CachedComponent* cached)
     }
 }
 
-void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::string parent_id, daq::ComponentPtr owner)
+CachedComponent* OpenDAQNodeEditor::CacheComponent(std::unique_ptr<CachedComponent> cached)
 {
-    if (component == nullptr)
+    CachedComponent* raw = cached.get();
+    components_by_handle_.Set(raw->handle_, raw);
+    if (raw->parent_handle_ != INVALID_COMPONENT_HANDLE)
+        components_by_parent_[raw->parent_handle_].push_back(raw->handle_);
+    all_components_[raw->uid_] = std::move(cached);
+    return raw;
+}
+
+void OpenDAQNodeEditor::UncacheParent(const CachedComponent* cached)
+{
+    auto it = components_by_parent_.find(cached->parent_handle_);
+    if (it == components_by_parent_.end())
         return;
+    auto& siblings = it->second;
+    siblings.erase(std::remove(siblings.begin(), siblings.end(), cached->handle_), siblings.end());
+    if (siblings.empty())
+        components_by_parent_.erase(it);
+}
+
+// A component added and removed within the same frame, or one that was hidden, must not be walked (back) in
+static bool IsShown(daq::ComponentPtr component)
+{
+    for (daq::ComponentPtr parent = component.getParent(); parent.assigned(); component = parent, parent = parent.getParent())
+    {
+        daq::FolderPtr folder = parent.asPtrOrNull<daq::IFolder>(true);
+        if (!folder.assigned() || !folder.hasItem(component.getLocalId()) || !component.getVisible())
+            return false;
+    }
+    return true;
+}
+
+// Reads a subtree with all of its openDAQ round trips, safe to run on a worker thread. With defer_devices,
+// devices below the root are left as placeholders so each of them can be read by a worker of its own.
+static std::unique_ptr<OpenDAQNodeEditor::StagedTopology> StageTopology(daq::ComponentPtr component, bool defer_devices)
+{
+    if (component == nullptr)
+        return nullptr;
 
     if (canCastTo<daq::IFolder>(component) && daq::FolderPtr(castTo<daq::IFolder>(component)).isEmpty())
-        return;
+        return nullptr;
 
     if (component.getName() == "IP" || component.getName() == "Sig")
         // input ports and signals are handled by checking them per component instead, so we skip them here
-        return;
+        return nullptr;
 
-    CachedComponent* cached = nullptr;
-    std::string component_id = component.getGlobalId().toStdString();
-    if (auto it = all_components_.find(component_id); it != all_components_.end())
-    {
-        cached = it->second.get();
-    }
-    else
-    {
-        all_components_[component_id] = std::make_unique<CachedComponent>(component);
-        cached = all_components_[component_id].get();
-    }
-    cached->owner_ = owner;
-    cached->RefreshStructure();
-    cached->children_.clear();
+    auto staged = std::make_unique<OpenDAQNodeEditor::StagedTopology>();
+    staged->component = component;
+    staged->cached = std::make_unique<CachedComponent>(component, CachedComponent::DetachedTag{});
+    staged->cached->RefreshStructure();
 
     if (canCastTo<daq::IFunctionBlock>(component))
     {
         daq::FunctionBlockPtr function_block = castTo<daq::IFunctionBlock>(component);
         for (const daq::InputPortPtr& input_port : function_block.getInputPorts())
-        {
-            std::string input_id = input_port.getGlobalId().toStdString();
-            auto input_cached = std::make_unique<CachedComponent>(input_port);
-            input_ports_[input_id] = input_cached.get();
-            input_cached->parent_ = component;
-            input_cached->owner_ = component;
-            all_components_[input_id] = std::move(input_cached);
-        }
-
+            staged->input_ports.push_back(std::make_unique<CachedComponent>(input_port, CachedComponent::DetachedTag{}));
         for (const daq::SignalPtr& signal : function_block.getSignals())
-        {
-            std::string signal_id = signal.getGlobalId().toStdString();
-            auto signal_cached = std::make_unique<CachedComponent>(signal);
-            signals_[signal_id] = signal_cached.get();
-            signal_cached->parent_ = component;
-            signal_cached->owner_ = component;
-            all_components_[signal_id] = std::move(signal_cached);
-        }
+            staged->signals.push_back(std::make_unique<CachedComponent>(signal, CachedComponent::DetachedTag{}));
     }
     if (canCastTo<daq::IDevice>(component))
     {
         daq::DevicePtr device = castTo<daq::IDevice>(component);
         for (const daq::SignalPtr& signal : device.getSignals())
+            staged->signals.push_back(std::make_unique<CachedComponent>(signal, CachedComponent::DetachedTag{}));
+    }
+
+    if (canCastTo<daq::IFolder>(component))
+    {
+        daq::FolderPtr folder = castTo<daq::IFolder>(component);
+        for (const auto& item : folder.getItems())
         {
-            std::string signal_id = signal.getGlobalId().toStdString();
-            auto signal_cached = std::make_unique<CachedComponent>(signal);
-            signals_[signal_id] = signal_cached.get();
-            signal_cached->parent_ = component;
-            signal_cached->owner_ = component;
-            all_components_[signal_id] = std::move(signal_cached);
+            if (defer_devices && canCastTo<daq::IDevice>(item))
+            {
+                auto placeholder = std::make_unique<OpenDAQNodeEditor::StagedTopology>();
+                placeholder->component = item;
+                staged->children.push_back(std::move(placeholder));
+            }
+            else if (auto child = StageTopology(item, defer_devices))
+            {
+                staged->children.push_back(std::move(child));
+            }
         }
     }
+    return staged;
+}
 
+void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::string parent_id, daq::ComponentPtr owner)
+{
+    if (auto staged = StageTopology(component, false))
+        MergeTopology(*staged, parent_id, owner);
+}
+
+void OpenDAQNodeEditor::MergeTopology(StagedTopology& staged, std::string parent_id, daq::ComponentPtr owner)
+{
+    daq::ComponentPtr component = staged.component;
+    if (!staged.cached)
+    {
+        pending_topologies_.push_back({std::async(std::launch::async, [component]() { return StageTopology(component, false); }), parent_id, owner,
+                                       component.getGlobalId().toStdString()});
+        return;
+    }
+
+    std::string component_id = staged.cached->uid_;
+    const std::string& name = staged.cached->name_;
+    bool is_dummy_folder = component == instance_ || name == "IO" || name == "AI" || name == "AO" || name == "Dev" || name == "FB";
+    // the parent is set before caching, so the component lands in components_by_parent_ right away
+    if (!is_dummy_folder)
+        staged.cached->SetParent(parent_id.empty() ? nullptr : folders_[parent_id]->component_);
+    CachedComponent* cached = CacheComponent(std::move(staged.cached));
+    cached->Attach();
+    cached->owner_ = owner;
+    cached->children_.clear();
+
+    for (auto& input_cached : staged.input_ports)
+    {
+        input_cached->Attach();
+        input_cached->SetParent(component);
+        input_cached->owner_ = component;
+        input_ports_[input_cached->uid_] = input_cached.get();
+        CacheComponent(std::move(input_cached));
+    }
+    for (auto& signal_cached : staged.signals)
+    {
+        signal_cached->Attach();
+        signal_cached->SetParent(component);
+        signal_cached->owner_ = component;
+        signals_[signal_cached->uid_] = signal_cached.get();
+        CacheComponent(std::move(signal_cached));
+    }
 
     std::string new_parent_id = "";
-    if (component == instance_ || component.getName() == "IO" || component.getName() == "AI" || component.getName() == "AO" || component.getName() == "Dev" || component.getName() == "FB")
+    if (is_dummy_folder)
     {
         // just a dummy folder we should skip
         assert(cached->input_ports_.empty());
@@ -426,8 +624,6 @@ void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::strin
     }
     else
     {
-        cached->parent_ = parent_id.empty() ? nullptr : folders_[parent_id]->component_;
-        
         if (canCastTo<daq::IDevice>(component))
             cached->color_index_ = next_color_index_++;
         else if (!parent_id.empty())
@@ -450,7 +646,7 @@ void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::strin
         }
         else
         {
-            nodes_.AddNode({component.getName().toStdString(), component_id}, 
+            nodes_.AddNode({cached->name_, component_id},
                             GetNodeColor(cached->color_index_),
                             cached->input_ports_,
                             cached->output_signals_,
@@ -473,12 +669,16 @@ void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::strin
                     nodes_.EmbedNode(component_id, parent_id);
             }
 
-            if (!component.getActive())
+            if (!cached->is_active_)
                 nodes_.SetActive(component_id, false);
 
-            UpdateSignalsActiveState(cached);
+            // the staged signals already know whether they are active, no need to ask the device again
+            for (const auto& signal_id : cached->output_signals_)
+            {
+                if (auto it = signals_.find(signal_id.id_); it != signals_.end())
+                    nodes_.SetActive(signal_id.id_, it->second->is_active_);
+            }
 
-            cached->RefreshStatus();
             if (!cached->error_message_.empty())
                 nodes_.SetError(component_id, cached->error_message_);
             else if (!cached->warning_message_.empty())
@@ -489,24 +689,182 @@ void OpenDAQNodeEditor::RetrieveTopology(daq::ComponentPtr component, std::strin
         }
     }
 
-    if (canCastTo<daq::IFolder>(component))
+    daq::ComponentPtr new_owner = owner;
+    if (canCastTo<daq::IInstance>(component) || canCastTo<daq::IDevice>(component) || canCastTo<daq::IFunctionBlock>(component))
+        new_owner = component;
+
+    for (auto& child : staged.children)
     {
-        daq::ComponentPtr new_owner = owner;
-        if (canCastTo<daq::IInstance>(component) || canCastTo<daq::IDevice>(component) || canCastTo<daq::IFunctionBlock>(component))
-            new_owner = component;
+        MergeTopology(*child, new_parent_id, new_owner);
+        if (auto it = all_components_.find(child->component.getGlobalId().toStdString()); it != all_components_.end())
+            cached->children_.push_back(it->second->handle_);
+    }
+}
 
-        daq::FolderPtr folder = castTo<daq::IFolder>(component);
-        for (const auto& item : folder.getItems())
+void OpenDAQNodeEditor::PollPendingTopologies()
+{
+    abandoned_topologies_.erase(std::remove_if(abandoned_topologies_.begin(), abandoned_topologies_.end(),
+                                               [](const std::future<std::unique_ptr<StagedTopology>>& load)
+                                               { return load.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }),
+                                abandoned_topologies_.end());
+    if (pending_topologies_.empty())
+        return;
+
+    // merging may queue nested placeholders, so the landed ones are taken out first
+    std::vector<PendingTopology> landed;
+    for (auto it = pending_topologies_.begin(); it != pending_topologies_.end(); )
+    {
+        if (it->staged.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
         {
-            RetrieveTopology(item, new_parent_id, new_owner);
-            std::string item_id = item.getGlobalId().toStdString();
-            if (all_components_.find(item_id) != all_components_.end())
-                cached->children_.push_back({item.getName().toStdString(), item_id});
+            landed.push_back(std::move(*it));
+            it = pending_topologies_.erase(it);
+        }
+        else
+        {
+            ++it;
         }
     }
+    if (landed.empty())
+        return;
+
+    nodes_.BeginBatchAdd();
+    std::vector<std::string> landed_ids;
+    bool removed_any = false;
+    for (PendingTopology& pending : landed)
+    {
+        std::unique_ptr<StagedTopology> staged;
+        try
+        {
+            staged = pending.staged.get();
+        }
+        catch (const std::exception& e)
+        {
+            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to read device: %s", e.what()});
+        }
+        catch (...)
+        {
+            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to read device: Unknown error"});
+        }
+        if (!staged)
+            continue;
+
+        // a structural event may have walked the device in the meantime, the landed copy replaces it
+        std::string id = staged->cached->uid_;
+        if (all_components_.find(id) != all_components_.end())
+        {
+            RemoveTopology(id);
+            removed_any = true;
+        }
+        // the device may also have been removed or hidden while it was being read
+        if (!IsShown(staged->component))
+            continue;
+
+        MergeTopology(*staged, pending.parent_id, pending.owner);
+        if (auto it = all_components_.find(id); it != all_components_.end())
+        {
+            if (auto folder_it = all_components_.find(id.substr(0, id.rfind('/'))); folder_it != all_components_.end())
+                folder_it->second->children_.push_back(it->second->handle_);
+        }
+        landed_ids.push_back(id);
+    }
+    nodes_.EndBatchAdd();
+
+    for (const std::string& id : landed_ids)
+        RetrieveConnections(id);
+
+    bool apply_pending_state = has_pending_state_ && pending_topologies_.empty();
+    if (apply_pending_state)
+        ApplyPendingState();
+    // the windows may still point at components the merge replaced, whatever the restored state selected
+    if (!apply_pending_state || removed_any)
+        RestoreWindowSelections();
 }
 
-void OpenDAQNodeEditor::RetrieveConnections()
+OpenDAQNodeEditor::TopologySnapshot OpenDAQNodeEditor::TakeTopologySnapshot() const
+{
+    TopologySnapshot snapshot;
+    snapshot.connection_string = startup_connection_string_;
+
+    std::vector<std::string> node_ids;
+    for (const auto& [id, cached] : folders_)
+    {
+        if (nodes_.HasNode(id))
+            node_ids.push_back(id);
+    }
+    // a parent's id is a prefix of its children's, so sorted ids add every parent node before its children
+    std::sort(node_ids.begin(), node_ids.end());
+    for (const std::string& id : node_ids)
+    {
+        const CachedComponent* cached = folders_.at(id);
+        snapshot.nodes.push_back({id, FindNodeParentId(cached->parent_), cached->name_, cached->color_index_, cached->input_ports_, cached->output_signals_});
+    }
+
+    for (const auto& [input_uid, cached] : input_ports_)
+    {
+        daq::InputPortPtr input_port = castTo<daq::IInputPort>(cached->component_);
+        if (input_port.assigned() && input_port.getSignal().assigned())
+            snapshot.connections.push_back({input_port.getSignal().getGlobalId().toStdString(), input_uid});
+    }
+    return snapshot;
+}
+
+void OpenDAQNodeEditor::ShowTopologySnapshot()
+{
+    is_topology_snapshot_checked_ = true;
+    // a snapshot of another device has nothing to offer, neither has one once the live topology is in
+    if (topology_snapshot_.nodes.empty() || topology_snapshot_.connection_string != startup_connection_string_ || !all_components_.empty())
+    {
+        topology_snapshot_ = {};
+        return;
+    }
+
+    nodes_.BeginBatchAdd();
+    for (const auto& node : topology_snapshot_.nodes)
+    {
+        nodes_.AddNode({node.name, node.id}, GetNodeColor(node.color_index), node.inputs, node.outputs, node.parent_id);
+        nodes_.SetStale(node.id, true);
+    }
+    nodes_.EndBatchAdd();
+
+    for (const auto& [signal_id, input_id] : topology_snapshot_.connections)
+    {
+        std::optional<ImColor> color;
+        if (auto it = CachedComponent::signal_colors_.find(signal_id); it != CachedComponent::signal_colors_.end())
+            color = ImColor(it->second);
+        nodes_.AddConnection(signal_id, input_id, color);
+    }
+    showing_topology_snapshot_ = true;
+}
+
+void OpenDAQNodeEditor::DropStaleNodes()
+{
+    showing_topology_snapshot_ = false;
+    topology_snapshot_ = {};
+    nodes_.RemoveNodes(nodes_.GetStaleNodes());
+}
+
+void OpenDAQNodeEditor::AddStartupDevice(const std::string& connection_string)
+{
+    startup_connection_string_ = connection_string;
+    startup_device_ = std::async(std::launch::async, [instance = instance_, connection_string]() mutable { instance.addDevice(connection_string); });
+}
+
+void OpenDAQNodeEditor::PollStartupDevice()
+{
+    if (!startup_device_.valid() || startup_device_.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    try
+    {
+        startup_device_.get();
+    }
+    catch (const std::exception& e)
+    {
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to connect to %s: %s", startup_connection_string_.c_str(), e.what()});
+    }
+}
+
+void OpenDAQNodeEditor::RetrieveConnections(const std::string& subtree_id)
 {
     for (const auto& [input_uid, cached] : input_ports_)
     {
@@ -515,6 +873,9 @@ void OpenDAQNodeEditor::RetrieveConnections()
         {
             daq::SignalPtr connected_signal = input_port.getSignal();
             std::string signal_uid = connected_signal.getGlobalId().toStdString();
+            // after a patch only connections touching the re-added nodes are missing
+            if (!subtree_id.empty() && !IsInSubtree(input_uid, subtree_id) && !IsInSubtree(signal_uid, subtree_id))
+                continue;
             ImVec4 color = ImVec4(1,1,1,1);
             if (auto it = signals_.find(signal_uid); it != signals_.end())
                 color = it->second->GetSignalColor();
@@ -555,14 +916,17 @@ void OpenDAQNodeEditor::RebuildNodeConnections(const std::string& node_id)
         // Also reconnect ports from hidden nested FBs (FBs inside channels whose ports are on this node)
         if (canCastTo<daq::IChannel>(cached->component_))
         {
-            for (const auto& [comp_id, comp] : all_components_)
+            if (auto children_it = components_by_parent_.find(cached->handle_); children_it != components_by_parent_.end())
             {
-                if (comp->parent_.assigned() && comp->parent_ == cached->component_
-                    && canCastTo<daq::IFunctionBlock>(comp->component_)
-                    && !canCastTo<daq::IChannel>(comp->component_)
-                    && !nodes_.HasNode(comp_id))
+                for (ComponentHandle child_handle : children_it->second)
                 {
-                    reconnect_ports(comp.get());
+                    CachedComponent* comp = components_by_handle_[child_handle];
+                    if (comp && canCastTo<daq::IFunctionBlock>(comp->component_)
+                        && !canCastTo<daq::IChannel>(comp->component_)
+                        && !nodes_.HasNode(comp->uid_))
+                    {
+                        reconnect_ports(comp);
+                    }
                 }
             }
         }
@@ -571,76 +935,485 @@ void OpenDAQNodeEditor::RebuildNodeConnections(const std::string& node_id)
 
 void OpenDAQNodeEditor::RebuildStructure()
 {
-    nodes_.Clear();
+    if (showing_topology_snapshot_)
+    {
+        // the stale nodes stay until live ones with the same uid take them over
+        std::vector<ImGui::ImGuiNodesUid> live_node_ids;
+        for (const auto& [id, cached] : folders_)
+            live_node_ids.push_back(id);
+        nodes_.RemoveNodes(live_node_ids);
+    }
+    else
+    {
+        nodes_.Clear();
+    }
     all_components_.clear();
+    components_by_handle_.Clear();
+    components_by_parent_.clear();
     folders_.clear();
     input_ports_.clear();
     signals_.clear();
+    signal_previews_.Clear();
     next_color_index_ = 1;
+    instance_handle_ = InternComponentId(instance_.getGlobalId().toStdString());
+    // subtrees still being read belong to the old structure, their futures are kept until they finish so nothing blocks here
+    for (PendingTopology& pending : pending_topologies_)
+        abandoned_topologies_.push_back(std::move(pending.staged));
+    pending_topologies_.clear();
 
+    // the instance itself is read right away, every device below it lands on its own as soon as its worker is done
     nodes_.BeginBatchAdd();
-    RetrieveTopology(instance_);
+    if (auto staged = StageTopology(instance_, true))
+        MergeTopology(*staged, "", nullptr);
     nodes_.EndBatchAdd();
     RetrieveConnections();
 
-    if (has_pending_state_)
+    if (has_pending_state_ && pending_topologies_.empty())
+        ApplyPendingState();
+    else
+        RestoreWindowSelections();
+}
+
+void OpenDAQNodeEditor::ApplyPendingState()
+{
+    has_pending_state_ = false;
+
+    // Restore selection
+    if (!pending_selected_ids_.empty())
+    {
+        // Filter to only IDs that actually exist in the current topology
+        std::vector<std::string> valid_ids;
+        for (const auto& id : pending_selected_ids_)
+        {
+            if (all_components_.find(id) != all_components_.end())
+                valid_ids.push_back(id);
+        }
+        pending_selected_ids_.clear();
+
+        if (!valid_ids.empty())
+        {
+            selected_ids_ = valid_ids;
+            nodes_.SetSelectedNodes(selected_ids_);
+            properties_window_.OnSelectionChanged(selected_ids_, all_components_);
+            signals_window_.OnSelectionChanged(selected_ids_, all_components_);
+            tree_view_window_.OnSelectionChanged(selected_ids_, all_components_);
+        }
+    }
+
+    // Restore cloned windows
+    for (auto& w : pending_cloned_properties_)
+    {
+        if (w->clone_id_ >= next_clone_id_)
+            next_clone_id_ = w->clone_id_ + 1;
+        w->force_auto_resize_next_frame_ = !w->tabbed_interface_;
+        w->on_reselect_click_ = properties_window_.on_reselect_click_;
+        w->on_property_changed_ = properties_window_.on_property_changed_;
+        w->components_by_handle_ = &components_by_handle_;
+        w->property_writes_ = &property_writes_;
+        w->core_event_stats_ = &core_event_stats_;
+        w->RestoreSelection(all_components_);
+        cloned_properties_windows_.push_back(std::move(w));
+    }
+    pending_cloned_properties_.clear();
+
+    for (auto& w : pending_cloned_signals_)
+    {
+        if (w->clone_id_ >= next_clone_id_)
+            next_clone_id_ = w->clone_id_ + 1;
+        w->on_reselect_click_ = signals_window_.on_reselect_click_;
+        w->RestoreSelection(all_components_);
+        cloned_signals_windows_.push_back(std::move(w));
+    }
+    pending_cloned_signals_.clear();
+}
+
+void OpenDAQNodeEditor::RestoreWindowSelections()
+{
+    properties_window_.RestoreSelection(all_components_);
+    for (auto& w : cloned_properties_windows_)
+        w->RestoreSelection(all_components_);
+
+    signals_window_.RestoreSelection(all_components_);
+    for (auto& w : cloned_signals_windows_)
+        w->RestoreSelection(all_components_);
+}
+
+std::string OpenDAQNodeEditor::FindNodeParentId(daq::ComponentPtr component) const
+{
+    // the same node RetrieveTopology would pass down as parent_id: dummy folders and FBs hidden inside channels have none
+    for (; component.assigned(); component = component.getParent())
+    {
+        std::string id = component.getGlobalId().toStdString();
+        if (folders_.find(id) != folders_.end() && nodes_.HasNode(id))
+            return id;
+    }
+    return "";
+}
+
+std::vector<CachedComponent*> OpenDAQNodeEditor::CollectSubtree(const std::string& root_id) const
+{
+    std::vector<CachedComponent*> subtree;
+    auto root_it = all_components_.find(root_id);
+    if (root_it == all_components_.end())
+    {
+        // an uncached root, like a port folder, has no child lists, only the ids tell what is below it
+        for (const auto& [id, cached] : all_components_)
+        {
+            if (IsInSubtree(id, root_id))
+                subtree.push_back(cached.get());
+        }
+        return subtree;
+    }
+
+    // children_ holds the openDAQ children including dummy folders, components_by_parent_ the ports, signals
+    // and the components whose dummy folder was skipped
+    std::unordered_set<ComponentHandle> visited = {root_it->second->handle_};
+    subtree.push_back(root_it->second.get());
+    auto visit = [&](ComponentHandle handle)
+        {
+            CachedComponent* child = components_by_handle_[handle];
+            if (child && visited.insert(handle).second)
+                subtree.push_back(child);
+        };
+    for (size_t i = 0; i < subtree.size(); ++i)
+    {
+        for (ComponentHandle child_handle : subtree[i]->children_)
+            visit(child_handle);
+        if (auto children_it = components_by_parent_.find(subtree[i]->handle_); children_it != components_by_parent_.end())
+        {
+            for (ComponentHandle child_handle : children_it->second)
+                visit(child_handle);
+        }
+    }
+    return subtree;
+}
+
+std::vector<ImGui::ImGuiNodesUid> OpenDAQNodeEditor::RemoveTopology(const std::string& root_id)
+{
+    std::vector<ImGui::ImGuiNodesUid> node_ids;
+    std::vector<std::string> removed_ids;
+    for (CachedComponent* cached : CollectSubtree(root_id))
+        removed_ids.push_back(cached->uid_);
+
+    for (const std::string& id : removed_ids)
+    {
+        auto it = all_components_.find(id);
+        if (nodes_.HasNode(id))
+            node_ids.push_back(id);
+        folders_.erase(id);
+        input_ports_.erase(id);
+        if (signals_.erase(id))
+            signal_previews_.Remove(id);
+        components_by_handle_.Set(it->second->handle_, nullptr);
+        UncacheParent(it->second.get());
+        all_components_.erase(it);
+    }
+
+    if (auto parent_it = all_components_.find(root_id.substr(0, root_id.rfind('/'))); parent_it != all_components_.end())
+    {
+        auto& children = parent_it->second->children_;
+        children.erase(std::remove(children.begin(), children.end(), FindComponentHandle(root_id)), children.end());
+    }
+
+    // devices of the subtree still being read would otherwise be merged back in when they land
+    for (auto it = pending_topologies_.begin(); it != pending_topologies_.end(); )
+    {
+        if (IsInSubtree(it->root_id, root_id))
+        {
+            abandoned_topologies_.push_back(std::move(it->staged));
+            it = pending_topologies_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return nodes_.RemoveNodes(node_ids);
+}
+
+daq::ComponentPtr OpenDAQNodeEditor::FindPatchRoot(daq::ComponentPtr component)
+{
+    // find the smallest cached subtree that contains the change
+    daq::ComponentPtr root = component;
+    while (root.assigned())
+    {
+        daq::ComponentPtr parent = root.getParent();
+        if (!parent.assigned())
+            break;
+
+        // signals and input ports are created by their owner and shown on its node, empty folders were never cached
+        bool is_port_or_signal = root.getName() == "IP" || root.getName() == "Sig" || canCastTo<daq::ISignal>(root) || canCastTo<daq::IInputPort>(root);
+        if (is_port_or_signal || all_components_.find(parent.getGlobalId().toStdString()) == all_components_.end())
+        {
+            root = parent;
+            continue;
+        }
+
+        // a channel's node carries the ports of every FB nested inside it, so the whole channel is redone
+        std::string node_parent_id = FindNodeParentId(parent);
+        if (!node_parent_id.empty() && canCastTo<daq::IChannel>(folders_[node_parent_id]->component_))
+        {
+            root = folders_[node_parent_id]->component_;
+            continue;
+        }
+        break;
+    }
+
+    if (!root.assigned() || !root.getParent().assigned() || root.getGlobalId() == instance_.getGlobalId())
+        return nullptr;
+    return root;
+}
+
+bool OpenDAQNodeEditor::RemovalChangesSurvivingNode(daq::ComponentPtr folder) const
+{
+    // removing a port, a signal or something inside a channel changes the ports of a node that stays
+    if (all_components_.find(folder.getGlobalId().toStdString()) == all_components_.end())
+        return true;
+    std::string node_parent_id = FindNodeParentId(folder);
+    return !node_parent_id.empty() && canCastTo<daq::IChannel>(folders_.at(node_parent_id)->component_);
+}
+
+void OpenDAQNodeEditor::PatchTopology(daq::ComponentPtr root)
+{
+    std::string root_id = root.getGlobalId().toStdString();
+    std::vector<ImGui::ImGuiNodesUid> restored_node_ids = RemoveTopology(root_id);
+    if (!IsShown(root))
     {
-        has_pending_state_ = false;
+        nodes_.RestoreCachedEmbedding(restored_node_ids);
+        return;
+    }
 
-        // Restore selection
-        if (!pending_selected_ids_.empty())
+    daq::ComponentPtr parent = root.getParent();
+    std::string node_parent_id = FindNodeParentId(parent);
+    daq::ComponentPtr owner;
+    for (daq::ComponentPtr candidate = parent; candidate.assigned(); candidate = candidate.getParent())
+    {
+        if (canCastTo<daq::IInstance>(candidate) || canCastTo<daq::IDevice>(candidate) || canCastTo<daq::IFunctionBlock>(candidate))
         {
-            // Filter to only IDs that actually exist in the current topology
-            std::vector<std::string> valid_ids;
-            for (const auto& id : pending_selected_ids_)
+            owner = candidate;
+            break;
+        }
+    }
+
+    RetrieveTopology(root, node_parent_id, owner);
+
+    if (auto root_it = all_components_.find(root_id); root_it != all_components_.end())
+    {
+        if (auto parent_it = all_components_.find(parent.getGlobalId().toStdString()); parent_it != all_components_.end())
+            parent_it->second->children_.push_back(root_it->second->handle_);
+    }
+    for (CachedComponent* cached : CollectSubtree(root_id))
+    {
+        if (nodes_.HasNode(cached->uid_))
+            restored_node_ids.push_back(cached->uid_);
+    }
+    nodes_.RestoreCachedEmbedding(restored_node_ids);
+    RetrieveConnections(root_id);
+}
+
+// Events whose effect only depends on the latest one of their kind per component, nullptr for those that must all be applied
+static const char* CoreEventKeyPrefix(int event_id)
+{
+    switch (event_id)
+    {
+        case static_cast<int>(daq::CoreEventId::AttributeChanged): return "attribute:";
+        case static_cast<int>(daq::CoreEventId::PropertyValueChanged): return "value:";
+        case static_cast<int>(daq::CoreEventId::PropertyAdded):
+        case static_cast<int>(daq::CoreEventId::PropertyRemoved): return "metadata:";
+        case static_cast<int>(daq::CoreEventId::DataDescriptorChanged): return "descriptor:";
+        case static_cast<int>(daq::CoreEventId::SignalConnected):
+        case static_cast<int>(daq::CoreEventId::SignalDisconnected): return "connection:";
+        case static_cast<int>(daq::CoreEventId::StatusChanged): return "status:";
+        default: return nullptr;
+    }
+}
+
+OpenDAQNodeEditor::CoreEventBatch OpenDAQNodeEditor::ReduceCoreEvents(std::vector<std::pair<daq::ComponentPtr, daq::CoreEventArgsPtr>>& events)
+{
+    CoreEventBatch batch;
+    std::vector<daq::ComponentPtr> patch_roots;
+    std::vector<std::string> removed_ids;
+    // index into batch.events of the latest event per key, earlier ones with the same key are superseded
+    std::unordered_map<std::string, std::size_t> latest_by_key;
+    std::vector<bool> superseded;
+
+    for (auto& [comp, args] : events)
+    {
+        int event_id = static_cast<int>(args.getEventId());
+        daq::DictPtr<daq::IString, daq::IBaseObject> params = args.getParameters();
+
+        if (event_id == static_cast<int>(daq::CoreEventId::ComponentAdded)
+            || event_id == static_cast<int>(daq::CoreEventId::ComponentUpdateEnd)
+            || event_id == static_cast<int>(daq::CoreEventId::ComponentRemoved))
+        {
+            daq::ComponentPtr changed = comp;
+            if (event_id == static_cast<int>(daq::CoreEventId::ComponentAdded))
             {
-                if (all_components_.find(id) != all_components_.end())
-                    valid_ids.push_back(id);
+                if (!params.hasKey("Component"))
+                {
+                    batch.rebuild_structure = true;
+                    continue;
+                }
+                changed = params.get("Component").asPtr<daq::IComponent>();
+                if (canCastTo<daq::IDevice>(changed))
+                    function_block_catalog_.InvalidateDevice(changed.getGlobalId().toStdString());
             }
-            pending_selected_ids_.clear();
-
-            if (!valid_ids.empty())
+            else if (event_id == static_cast<int>(daq::CoreEventId::ComponentRemoved))
             {
-                selected_ids_ = valid_ids;
-                nodes_.SetSelectedNodes(selected_ids_);
-                properties_window_.OnSelectionChanged(selected_ids_, all_components_);
-                signals_window_.OnSelectionChanged(selected_ids_, all_components_);
-                tree_view_window_.OnSelectionChanged(selected_ids_, all_components_);
+                if (!params.hasKey("Id"))
+                {
+                    batch.rebuild_structure = true;
+                    continue;
+                }
+                std::string removed_local_id = params.get("Id");
+                // a global id is the parent's id and the local id, so the removed component is a single lookup away
+                if (auto it = all_components_.find(comp.getGlobalId().toStdString() + "/" + removed_local_id); it != all_components_.end())
+                {
+                    const CachedComponent* cached = it->second.get();
+                    if (cached->component_.assigned() && canCastTo<daq::IDevice>(cached->component_))
+                    {
+                        std::string name = cached->component_.getName().toStdString();
+                        ImGui::InsertNotification({ImGuiToastType::Warning, DEFAULT_NOTIFICATION_DURATION_MS, "Device disconnected: %s", name.c_str()});
+                        function_block_catalog_.InvalidateDevice(it->first);
+                    }
+                }
+                if (!RemovalChangesSurvivingNode(comp))
+                {
+                    removed_ids.push_back(comp.getGlobalId().toStdString() + "/" + removed_local_id);
+                    continue;
+                }
             }
+
+            daq::ComponentPtr root = FindPatchRoot(changed);
+            if (root.assigned())
+                patch_roots.push_back(root);
+            else
+                batch.rebuild_structure = true;
+            continue;
         }
 
-        // Restore cloned windows
-        for (auto& w : pending_cloned_properties_)
+        // hidden components are filtered out of the walk, so showing or hiding one is a structural change of its subtree
+        if (event_id == static_cast<int>(daq::CoreEventId::AttributeChanged)
+            && params.hasKey("AttributeName") && params.get("AttributeName").toString().toStdString() == "Visible")
         {
-            if (w->clone_id_ >= next_clone_id_)
-                next_clone_id_ = w->clone_id_ + 1;
-            w->force_auto_resize_next_frame_ = !w->tabbed_interface_;
-            w->on_reselect_click_ = properties_window_.on_reselect_click_;
-            w->on_property_changed_ = properties_window_.on_property_changed_;
-            w->RestoreSelection(all_components_);
-            cloned_properties_windows_.push_back(std::move(w));
+            daq::ComponentPtr root = FindPatchRoot(comp);
+            if (root.assigned())
+                patch_roots.push_back(root);
+            else
+                batch.rebuild_structure = true;
+            continue;
         }
-        pending_cloned_properties_.clear();
 
-        for (auto& w : pending_cloned_signals_)
+        if (const char* key_prefix = CoreEventKeyPrefix(event_id); key_prefix != nullptr)
         {
-            if (w->clone_id_ >= next_clone_id_)
-                next_clone_id_ = w->clone_id_ + 1;
-            w->on_reselect_click_ = signals_window_.on_reselect_click_;
-            w->RestoreSelection(all_components_);
-            cloned_signals_windows_.push_back(std::move(w));
+            std::string key = key_prefix + comp.getGlobalId().toStdString();
+            if (event_id == static_cast<int>(daq::CoreEventId::AttributeChanged) && params.hasKey("AttributeName"))
+            {
+                key += ":" + params.get("AttributeName").toString().toStdString();
+            }
+            else if (event_id == static_cast<int>(daq::CoreEventId::PropertyValueChanged))
+            {
+                if (!params.hasKey("Name"))
+                    key = "resync"; // flags every open window, once is enough
+                else
+                    key += ":" + (params.hasKey("Path") ? params.get("Path").toString().toStdString() : std::string()) + "." + params.get("Name").toString().toStdString();
+            }
+
+            if (auto [it, inserted] = latest_by_key.try_emplace(key, batch.events.size()); !inserted)
+            {
+                superseded[it->second] = true;
+                it->second = batch.events.size();
+            }
         }
-        pending_cloned_signals_.clear();
+        batch.events.push_back({comp, args});
+        superseded.push_back(false);
     }
-    else
+
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < batch.events.size(); ++i)
+    {
+        if (!superseded[i])
+            batch.events[kept++] = std::move(batch.events[i]);
+    }
+    batch.events.resize(kept);
+
+    if (batch.rebuild_structure)
+        return batch;
+
+    // a root nested in another one is covered by the ancestor's walk, which reads the live tree anyway
+    std::sort(patch_roots.begin(), patch_roots.end(),
+              [](const daq::ComponentPtr& a, const daq::ComponentPtr& b) { return a.getGlobalId().toStdString() < b.getGlobalId().toStdString(); });
+    for (const daq::ComponentPtr& root : patch_roots)
+    {
+        std::string root_id = root.getGlobalId().toStdString();
+        if (batch.patch_roots.empty() || !IsInSubtree(root_id, batch.patch_roots.back().getGlobalId().toStdString()))
+            batch.patch_roots.push_back(root);
+    }
+
+    std::sort(removed_ids.begin(), removed_ids.end());
+    for (const std::string& removed_id : removed_ids)
     {
-        properties_window_.RestoreSelection(all_components_);
-        for (auto& w : cloned_properties_windows_)
-            w->RestoreSelection(all_components_);
+        bool covered = std::any_of(batch.patch_roots.begin(), batch.patch_roots.end(),
+                                   [&](const daq::ComponentPtr& root) { return IsInSubtree(removed_id, root.getGlobalId().toStdString()); });
+        if (!covered && (batch.removed_ids.empty() || !IsInSubtree(removed_id, batch.removed_ids.back())))
+            batch.removed_ids.push_back(removed_id);
+    }
+    return batch;
+}
 
-        signals_window_.RestoreSelection(all_components_);
-        for (auto& w : cloned_signals_windows_)
-            w->RestoreSelection(all_components_);
+void OpenDAQNodeEditor::ApplyStructuralChanges(const CoreEventBatch& batch)
+{
+    if (batch.rebuild_structure)
+    {
+        RebuildStructure();
+        core_event_stats_.applied++;
+        return;
+    }
+
+    // removals go first, so a component removed and added back in the same frame is walked in again by its patch
+    for (const std::string& removed_id : batch.removed_ids)
+        RemoveTopology(removed_id);
+    for (const daq::ComponentPtr& root : batch.patch_roots)
+        PatchTopology(root);
+
+    if (!batch.removed_ids.empty() || !batch.patch_roots.empty())
+        RestoreWindowSelections();
+    core_event_stats_.applied += batch.removed_ids.size() + batch.patch_roots.size();
+}
+
+void OpenDAQNodeEditor::RenameComponent(daq::ComponentPtr component)
+{
+    std::string component_id = component.getGlobalId().toStdString();
+    auto it = all_components_.find(component_id);
+    if (it == all_components_.end())
+        return;
+
+    CachedComponent* cached = it->second.get();
+    std::string name = component.getName().toStdString();
+    cached->name_ = name;
+    cached->needs_resync_ = true; // the name is also listed among its attributes
+    nodes_.RenameItem(component_id, name);
+
+    auto rename_in = [&](std::vector<ImGui::ImGuiNodesIdentifier>& identifiers)
+        {
+            for (auto& identifier : identifiers)
+            {
+                if (identifier.id_ == component_id)
+                    identifier.name_ = name;
+            }
+        };
+    // ports and signals are also listed by their owner, and by the channel whose node shows them
+    if (cached->parent_.assigned())
+    {
+        for (const std::string& holder_id : {cached->parent_.getGlobalId().toStdString(), FindNodeParentId(cached->parent_)})
+        {
+            if (auto holder_it = all_components_.find(holder_id); holder_it != all_components_.end())
+            {
+                rename_in(holder_it->second->input_ports_);
+                rename_in(holder_it->second->output_signals_);
+            }
+        }
     }
 }
 
@@ -662,8 +1435,8 @@ void OpenDAQNodeEditor::SetNodeActiveRecursively(const std::string& node_id)
 
         UpdateSignalsActiveState(cached);
 
-        for (const auto& child : cached->children_)
-            SetNodeActiveRecursively(child.id_);
+        for (ComponentHandle child : cached->children_)
+            SetNodeActiveRecursively(ComponentIdOf(child));
     }
 }
 
@@ -692,27 +1465,42 @@ void OpenDAQNodeEditor::OnConnectionRemoved(const ImGui::ImGuiNodesUid& input_id
 
 void OpenDAQNodeEditor::OnOutputHover(const ImGui::ImGuiNodesUid& id)
 {
-    static std::string last_id{""};
-    static OpenDAQSignal signal_preview;
-
     if (id == "")
     {
-        // user stopped hovering
-        signal_preview = OpenDAQSignal();
-        last_id = "";
+        // user stopped hovering, the reader stays pooled in case they come back
+        hovered_output_id_ = "";
         return;
     }
 
-    if (last_id != id && signals_.find(id) != signals_.end())
+    auto signal_it = signals_.find(id);
+    if (signal_it == signals_.end())
+        return;
+
+    OpenDAQSignal& signal_preview = signal_previews_.Acquire(castTo<daq::ISignal>(signal_it->second->component_));
+    if (hovered_output_id_ != id)
     {
-        // reinitialization with a new signal
-        last_id = id;
-        daq::SignalPtr signal = castTo<daq::ISignal>(signals_[id]->component_);
-        signal_preview = OpenDAQSignal(signal, 2.0, 800);
+        hovered_output_id_ = id;
+        // the outputs right next to this one on the node are the likely next hover
+        daq::ComponentPtr parent = signal_it->second->parent_;
+        auto node_it = parent.assigned() ? folders_.find(parent.getGlobalId().toStdString()) : folders_.end();
+        if (node_it != folders_.end())
+        {
+            const auto& outputs = node_it->second->output_signals_;
+            auto pos = std::find_if(outputs.begin(), outputs.end(), [&](const ImGui::ImGuiNodesIdentifier& output) { return output.id_ == id; });
+            std::vector<daq::SignalPtr> neighbours;
+            auto add_neighbour = [&](const std::string& neighbour_id)
+                {
+                    if (auto it = signals_.find(neighbour_id); it != signals_.end())
+                        neighbours.push_back(castTo<daq::ISignal>(it->second->component_));
+                };
+            if (pos != outputs.end() && pos != outputs.begin())
+                add_neighbour(std::prev(pos)->id_);
+            if (pos != outputs.end() && std::next(pos) != outputs.end())
+                add_neighbour(std::next(pos)->id_);
+            signal_previews_.Prewarm(neighbours);
+        }
     }
 
-    signal_preview.Update();
-
     if (ImGui::BeginTooltip())
     {
         ImVec4 signal_color = ImVec4(1,1,1,1);
@@ -799,44 +1587,17 @@ void OpenDAQNodeEditor::OnSelectionChanged(const std::vector<ImGui::ImGuiNodesUi
 
 void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_component, const std::string& parent_id, std::optional<ImVec2> position)
 {
-    if (!fb_options_cache_valid_)
+    // the list of the last session, or of an earlier menu, is shown while the current one is read in the background
+    const FunctionBlockCatalog::Entry& entry = function_block_catalog_.Request(parent_component);
+    if (!entry.is_loaded)
     {
-        try
-        {
-            if (canCastTo<daq::IInstance>(parent_component))
-            {
-                daq::InstancePtr instance = castTo<daq::IInstance>(parent_component);
-                cached_available_fbs_ = instance.getAvailableFunctionBlockTypes();
-            }
-            else if (canCastTo<daq::IDevice>(parent_component))
-            {
-                daq::DevicePtr device = castTo<daq::IDevice>(parent_component);
-                cached_available_fbs_ = device.getAvailableFunctionBlockTypes();
-            }
-            else if (canCastTo<daq::IFunctionBlock>(parent_component))
-            {
-                daq::FunctionBlockPtr function_block = castTo<daq::IFunctionBlock>(parent_component);
-                cached_available_fbs_ = function_block.getAvailableFunctionBlockTypes();
-            }
-            else
-            {
-                cached_available_fbs_ = nullptr;
-            }
-        }
-        catch (const std::exception& e)
-        {
-            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to get available function blocks: %s", e.what()});
-            cached_available_fbs_ = nullptr;
-        }
-        catch (...)
-        {
-            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to get available function blocks: Unknown error"});
-            cached_available_fbs_ = nullptr;
-        }
-        fb_options_cache_valid_ = true;
+        if (!entry.error.empty())
+            ImGui::TextDisabled("Failed to get available function blocks");
+        else
+            ImGui::TextDisabled("Loading function blocks...");
+        return;
     }
-
-    if (!cached_available_fbs_.assigned() || cached_available_fbs_.getCount() == 0)
+    if (entry.types.empty())
     {
         ImGui::Text("No function blocks available");
         return;
@@ -845,9 +1606,11 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
     if (ImSearch::BeginSearch())
     {
         ImSearch::SearchBar();
-        for (const auto [fb_id, desc] : cached_available_fbs_)
+        for (const FunctionBlockCatalog::Type& type : entry.types)
         {
-            std::string fb_id_str = fb_id.toStdString();
+            const std::string& fb_id = type.id;
+            const std::string& fb_description = type.description;
+            std::string fb_id_str = fb_id;
             ImSearch::SearchableItem(fb_id_str.c_str(), [=](const char*) {
                 if (ImGui::MenuItem(fb_id_str.c_str()))
                 {
@@ -875,7 +1638,7 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
                             std::string fb_id_str = fb.getGlobalId().toStdString();
 
                             auto fb_cached = std::make_unique<CachedComponent>(fb);
-                            fb_cached->parent_ = parent_component;
+                            fb_cached->SetParent(parent_component);
                             fb_cached->owner_ = parent_component;
                             auto parent_it = folders_.find(parent_id);
                             fb_cached->color_index_ = (parent_id.empty() || parent_it == folders_.end()) ? 0 : parent_it->second->color_index_;
@@ -885,20 +1648,20 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
                             {
                                 std::string input_id = input_port.getGlobalId().toStdString();
                                 auto input_cached = std::make_unique<CachedComponent>(input_port);
-                                input_cached->parent_ = fb;
+                                input_cached->SetParent(fb);
                                 input_cached->owner_ = fb;
                                 input_ports_[input_id] = input_cached.get();
-                                all_components_[input_id] = std::move(input_cached);
+                                CacheComponent(std::move(input_cached));
                             }
 
                             for (const daq::SignalPtr& signal : fb.getSignals())
                             {
                                 std::string signal_id = signal.getGlobalId().toStdString();
                                 auto signal_cached = std::make_unique<CachedComponent>(signal);
-                                signal_cached->parent_ = fb;
+                                signal_cached->SetParent(fb);
                                 signal_cached->owner_ = fb;
                                 signals_[signal_id] = signal_cached.get();
-                                all_components_[signal_id] = std::move(signal_cached);
+                                CacheComponent(std::move(signal_cached));
                             }
 
                             if (position.has_value())
@@ -929,7 +1692,7 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
                             UpdateSignalsActiveState(fb_cached.get());
 
                             folders_[fb_id_str] = fb_cached.get();
-                            all_components_[fb_id_str] = std::move(fb_cached);
+                            CacheComponent(std::move(fb_cached));
 
                             ImGui::CloseCurrentPopup();
                         }
@@ -944,10 +1707,10 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
                     }
                 }
 
-                if (ImGui::BeginItemTooltip())
+                if (!fb_description.empty() && ImGui::BeginItemTooltip())
                 {
                     ImGui::PushTextWrapPos(ImGui::GetFontSize() * 35.0f);
-                    ImGui::TextUnformatted(desc.getDescription().toStdString().c_str());
+                    ImGui::TextUnformatted(fb_description.c_str());
                     ImGui::PopTextWrapPos();
                     ImGui::EndTooltip();
                 }
@@ -957,25 +1720,21 @@ void OpenDAQNodeEditor::RenderFunctionBlockOptions(daq::ComponentPtr parent_comp
     }
 }
 
-static std::vector<OpenDAQNodeEditor::DiscoveredDeviceEntry> DiscoverDevicesSorted(daq::DevicePtr parent_device)
+DeviceDiscovery& OpenDAQNodeEditor::GetDeviceDiscovery(const daq::DevicePtr& parent_device)
 {
-    daq::ListPtr<daq::IDeviceInfo> available_devices = parent_device.getAvailableDevices();
-    std::vector<OpenDAQNodeEditor::DiscoveredDeviceEntry> devices;
-    if (available_devices.assigned())
+    std::unique_ptr<DeviceDiscovery>& discovery = device_discoveries_[parent_device.getGlobalId().toStdString()];
+    if (!discovery)
     {
-        devices.reserve(static_cast<size_t>(available_devices.getCount()));
-        for (const auto& device_info : available_devices)
-            devices.push_back({device_info.getName(), device_info.getConnectionString()});
+        std::vector<DeviceDiscovery::Source> sources;
+        if (parent_device == instance_)
+            sources = ModuleDiscoverySources(instance_);
+        else
+            sources.push_back(DeviceDiscoverySource(parent_device));
+        if (use_mock_discovery_ && parent_device == instance_)
+            sources.push_back(MockDiscoverySource(std::chrono::milliseconds(1500)));
+        discovery = std::make_unique<DeviceDiscovery>(std::move(sources));
     }
-
-    std::sort(devices.begin(), devices.end(),
-              [](const OpenDAQNodeEditor::DiscoveredDeviceEntry& a, const OpenDAQNodeEditor::DiscoveredDeviceEntry& b)
-              {
-                  if (a.name != b.name)
-                      return a.name < b.name;
-                  return a.connection_string < b.connection_string;
-              });
-    return devices;
+    return *discovery;
 }
 
 void OpenDAQNodeEditor::RenderDeviceOptions(daq::ComponentPtr parent_component, const std::string& parent_id, std::optional<ImVec2> position)
@@ -984,56 +1743,46 @@ void OpenDAQNodeEditor::RenderDeviceOptions(daq::ComponentPtr parent_component,
         return;
 
     daq::DevicePtr parent_device = castTo<daq::IDevice>(parent_component);
-
-    if (device_discovery_future_.valid())
+    DeviceDiscovery& discovery = GetDeviceDiscovery(parent_device);
+    discovery.MarkShown();
+
+    bool is_discovering = discovery.IsDiscovering();
+    std::string discover_button_label = (!discovery.Devices().empty()) ? "Refresh device list" : "Discover devices";
+    ImGui::BeginDisabled(is_discovering);
+    if (ImGui::Button(discover_button_label.c_str()))
+        discovery.Refresh();
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::Checkbox("Auto", &discovery.auto_refresh_);
+    if (discovery.auto_refresh_)
+    {
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 4.0f);
+        ImGui::DragFloat("##refresh_interval", &discovery.refresh_interval_seconds_, 0.1f, 1.0f, 60.0f, "%.0f s", ImGuiSliderFlags_AlwaysClamp);
+        ImGui::SetItemTooltip("Time between discovery rounds");
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("%s", ICON_FA_CIRCLE_INFO);
+    if (ImGui::BeginItemTooltip())
     {
-        if (device_discovery_future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        for (const DeviceDiscovery::SourceState& state : discovery.Sources())
         {
-            try
-            {
-                discovered_devices_sorted_ = device_discovery_future_.get();
-            }
-            catch (const std::exception& e)
-            {
-                ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to discover devices: %s", e.what()});
-                discovered_devices_sorted_.clear();
-            }
-            catch (...)
-            {
-                ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to discover devices: Unknown error"});
-                discovered_devices_sorted_.clear();
-            }
-            last_refresh_time_ = std::chrono::steady_clock::now();
+            if (state.round.valid())
+                ImGui::Text("%s: discovering...", state.source.name.c_str());
+            else if (state.last_latency_ms < 0.0)
+                ImGui::Text("%s: not run yet", state.source.name.c_str());
+            else
+                ImGui::Text("%s: %.0f ms", state.source.name.c_str(), state.last_latency_ms);
+            if (!state.error.empty())
+                ImGui::TextColored(COLOR_ERROR, "    %s", state.error.c_str());
         }
+        ImGui::EndTooltip();
     }
-
-    bool is_discovering = device_discovery_future_.valid();
-    std::string discover_button_label = (!discovered_devices_sorted_.empty()) ? "Refresh device list" : "Discover devices";
     if (is_discovering)
     {
-        ImGui::BeginDisabled();
-        ImGui::Button(discover_button_label.c_str());
-        ImGui::EndDisabled();
-        ImGui::SameLine();
-        ImGui::Checkbox("Auto", &auto_refresh_devices_);
         ImGui::SameLine();
         ImGui::ProgressBar(-1.0f * (float)ImGui::GetTime(), ImVec2(0.0f, 0.0f), "Discovering...");
     }
-    else
-    {
-        bool run_discovery = false;
-        run_discovery |= ImGui::Button(discover_button_label.c_str());
-        ImGui::SameLine();
-        run_discovery |= (ImGui::Checkbox("Auto", &auto_refresh_devices_) && auto_refresh_devices_);
-        run_discovery |= (auto_refresh_devices_ && std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - last_refresh_time_).count() >= 1);
-
-        if (run_discovery)
-            device_discovery_future_ = std::async(std::launch::async,
-                [parent_device]()
-                {
-                    return DiscoverDevicesSorted(parent_device);
-                });
-    }
 
     auto add_device = [&](const std::string& device_connection_string) -> bool
         {
@@ -1043,7 +1792,7 @@ void OpenDAQNodeEditor::RenderDeviceOptions(daq::ComponentPtr parent_component,
                 std::string dev_id = dev.getGlobalId().toStdString();
 
                 auto dev_cached = std::make_unique<CachedComponent>(dev);
-                dev_cached->parent_ = parent_component;
+                dev_cached->SetParent(parent_component);
                 dev_cached->owner_ = parent_component;
                 dev_cached->color_index_ = next_color_index_++;
                 dev_cached->RefreshStructure();
@@ -1072,7 +1821,7 @@ void OpenDAQNodeEditor::RenderDeviceOptions(daq::ComponentPtr parent_component,
                 UpdateSignalsActiveState(dev_cached.get());
 
                 folders_[dev_id] = dev_cached.get();
-                all_components_[dev_id] = std::move(dev_cached);
+                CacheComponent(std::move(dev_cached));
                 return true;
             }
             catch (const std::exception& e)
@@ -1087,16 +1836,26 @@ void OpenDAQNodeEditor::RenderDeviceOptions(daq::ComponentPtr parent_component,
             }
         };
 
-    if (!discovered_devices_sorted_.empty())
+    auto now = std::chrono::steady_clock::now();
+    for (const DeviceDiscovery::Device& device : discovery.Devices())
     {
-        for (const auto& device : discovered_devices_sorted_)
+        // devices missing from the latest rounds stay listed for a while, greyed out
+        float last_seen_seconds = std::chrono::duration<float>(now - device.last_seen).count();
+        bool is_missing = last_seen_seconds > discovery.refresh_interval_seconds_ * 2.0f;
+        if (is_missing)
+            ImGui::PushStyleColor(ImGuiCol_Text, ImGui::GetStyleColorVec4(ImGuiCol_TextDisabled));
+        bool clicked = ImGui::MenuItem((device.name + " (" + device.connection_string + ")").c_str());
+        if (is_missing)
+            ImGui::PopStyleColor();
+        if (ImGui::BeginItemTooltip())
         {
-            if (ImGui::MenuItem((device.name + " (" + device.connection_string + ")").c_str()))
-            {
-                if (add_device(device.connection_string))
-                    ImGui::CloseCurrentPopup();
-            }
+            ImGui::Text("Found by %s", device.source.c_str());
+            if (is_missing)
+                ImGui::Text("Last seen %.0f s ago", last_seen_seconds);
+            ImGui::EndTooltip();
         }
+        if (clicked && add_device(device.connection_string))
+            ImGui::CloseCurrentPopup();
     }
 
     static std::string device_connection_string = "daq.nd://";
@@ -1124,14 +1883,12 @@ void OpenDAQNodeEditor::BuildPopupParentCandidates(const std::string& parent_gui
                             || canCastTo<daq::IFunctionBlock>(cached->component_);
     if (supports_adding_fbs)
     {
-        daq::DictPtr<daq::IString, daq::IFunctionBlockType> available_nested_fbs;
+        // an FB is only offered once its catalog entry says it takes nested FBs, the popup is rebuilt when the entry lands
+        bool has_nested_fbs = false;
         if (canCastTo<daq::IFunctionBlock>(cached->component_))
-        {
-            daq::FunctionBlockPtr fb = castTo<daq::IFunctionBlock>(cached->component_);
-            available_nested_fbs = fb.getAvailableFunctionBlockTypes();
-        }
+            has_nested_fbs = !function_block_catalog_.Request(cached->component_).types.empty();
 
-        if (canCastTo<daq::IDevice>(cached->component_) || (available_nested_fbs.assigned() && available_nested_fbs.getCount() > 0))
+        if (canCastTo<daq::IDevice>(cached->component_) || has_nested_fbs)
         {
             std::string name = cached->component_.getName().toStdString();
             std::string global_id = cached->component_.getGlobalId().toStdString();
@@ -1140,8 +1897,8 @@ void OpenDAQNodeEditor::BuildPopupParentCandidates(const std::string& parent_gui
         }
     }
 
-    for (const ImGui::ImGuiNodesIdentifier &child : cached->children_)
-      BuildPopupParentCandidates(child.id_, depth, parent_color_index);
+    for (ComponentHandle child : cached->children_)
+      BuildPopupParentCandidates(ComponentIdOf(child), depth, parent_color_index);
 }
 
 static void CloseablePopupHeader(const std::string& label)
@@ -1184,7 +1941,6 @@ void OpenDAQNodeEditor::RenderPopupMenu(ImGui::ImGuiNodes* /*nodes*/, ImVec2 pos
                         popup_selected_parent_guid_ = candidate.guid;
                     else
                         popup_selected_parent_guid_ = instance_.getGlobalId().toStdString();
-                    fb_options_cache_valid_ = false;
                 }
             }
 
@@ -1243,15 +1999,14 @@ void OpenDAQNodeEditor::OnAddButtonClick(const ImGui::ImGuiNodesUid& parent_node
 void OpenDAQNodeEditor::RenderNestedNodePopup()
 {
     static bool was_context_menu_open = false;
-    static bool was_nested_menu_open = false;
 
     ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(8, 8));
 
     if (ImGui::BeginPopup("NodesContextMenu", ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize))
     {
-        if (!was_context_menu_open)
+        if (!was_context_menu_open || popup_parent_candidates_version_ != function_block_catalog_.Version())
         {
-            fb_options_cache_valid_ = false;
+            popup_parent_candidates_version_ = function_block_catalog_.Version();
             popup_parent_candidates_.clear();
             BuildPopupParentCandidates(instance_.getGlobalId().toStdString());
             bool parent_selection_still_valid = false;
@@ -1270,7 +2025,6 @@ void OpenDAQNodeEditor::RenderNestedNodePopup()
         RenderPopupMenu(&nodes_, add_button_drop_position_ ? add_button_drop_position_.value() : ImGui::GetMousePos());
         ImGui::EndPopup();
         was_context_menu_open = true;
-        was_nested_menu_open = false;
         ImGui::PopStyleVar();
         return;
     }
@@ -1278,9 +2032,6 @@ void OpenDAQNodeEditor::RenderNestedNodePopup()
 
     if (ImGui::BeginPopup("AddNestedNodeMenu", ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize))
     {
-        if (!was_nested_menu_open)
-            fb_options_cache_valid_ = false;
-
         if (add_button_click_component_ == nullptr)
         {
             ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "No component selected");
@@ -1317,11 +2068,9 @@ void OpenDAQNodeEditor::RenderNestedNodePopup()
         }
         
         ImGui::EndPopup();
-        was_nested_menu_open = true;
         ImGui::PopStyleVar();
         return;
     }
-    was_nested_menu_open = false;
 
     if (ImGui::BeginPopup("AddInputMenu", ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize))
     {
@@ -1387,15 +2136,6 @@ void OpenDAQNodeEditor::ShowStartupPopup()
         };
         srand((unsigned int)time(nullptr));
         current_hint_index = rand() % hints.size();
-
-        if (!is_device_discovery_initialized_)
-        {
-             is_device_discovery_initialized_ = true;
-             daq::DevicePtr parent_device = castTo<daq::IDevice>(instance_);
-             device_discovery_future_ = std::async(std::launch::async, [parent_device]() {
-                return DiscoverDevicesSorted(parent_device);
-             });
-        }
     }
 
     ImGui::SetNextWindowPos(ImGui::GetIO().DisplaySize * 0.5f, ImGuiCond_Always, ImVec2(0.5f, 0.5f));
@@ -1549,37 +2289,60 @@ void OpenDAQNodeEditor::OnInputDropped(const ImGui::ImGuiNodesUid& input_uid, st
 
 void OpenDAQNodeEditor::Render()
 {
+    if (!is_topology_snapshot_checked_)
+        ShowTopologySnapshot();
+    // polled before the event queue is drained, so the events of a device that just got in are handled this very frame
+    PollStartupDevice();
+    PollPendingTopologies();
+    for (const std::string& error : function_block_catalog_.Poll())
+        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to get available function blocks: %s", error.c_str()});
+    for (auto& [parent_id, discovery] : device_discoveries_)
     {
-        std::lock_guard<std::mutex> lock(event_mutex_);
+        for (const std::string& error : discovery->Update())
+            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to discover devices: %s", error.c_str()});
+    }
+    signal_previews_.Update();
+    property_writes_.Poll(all_components_);
+    for (auto it = detached_exports_.begin(); it != detached_exports_.end(); )
+    {
+        std::string export_error;
+        if (!it->PollFinished(export_error))
+        {
+            ++it;
+            continue;
+        }
+        if (export_error.empty())
+            ImGui::InsertNotification({ImGuiToastType::Success, DEFAULT_NOTIFICATION_DURATION_MS, "Exported signals to %s", it->path_.c_str()});
+        else
+            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to export signals: %s", export_error.c_str()});
+        it = detached_exports_.erase(it);
+    }
 
-        for (auto& [comp, args] : event_id_queue_)
+    {
+        std::vector<std::pair<daq::ComponentPtr, daq::CoreEventArgsPtr>> events;
+        {
+            std::lock_guard<std::mutex> lock(event_mutex_);
+            events.swap(event_id_queue_);
+        }
+        core_event_stats_.received += events.size();
+
+        CoreEventBatch batch = ReduceCoreEvents(events);
+        ApplyStructuralChanges(batch);
+        core_event_stats_.applied += batch.events.size();
+
+        for (auto& [comp, args] : batch.events)
         {
             switch (static_cast<int>(args.getEventId()))
             {
                 case static_cast<int>(daq::CoreEventId::StatusChanged):
                 {
                     std::string component_id = comp.getGlobalId().toStdString();
+                    // the component may have been removed by a structural change earlier in the same frame
                     if (folders_.find(component_id) == folders_.end())
-                    {
-                        assert(false && "Received status change for unknown component");
                         break;
-                    }
-
-                    CachedComponent* cached = folders_[component_id];
-                    cached->RefreshStatus();
-                    if (!cached->error_message_.empty())
-                    {
-                        nodes_.SetError(component_id, cached->error_message_);
-                        ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "'%s' error: %s", comp.getName().toStdString().c_str(), cached->error_message_.c_str()});
-                    }
-                    else if (!cached->warning_message_.empty())
-                    {
-                        nodes_.SetWarning(component_id, cached->warning_message_);
-                        ImGui::InsertNotification({ImGuiToastType::Warning, DEFAULT_NOTIFICATION_DURATION_MS, "'%s' warning: %s", comp.getName().toStdString().c_str(), cached->warning_message_.c_str()});
-                    }
-                    else
-                        nodes_.SetOk(component_id);
-
+                    // a flapping status raises many events per frame, the status itself is only read once after the queue is drained
+                    if (std::find(status_changed_ids_.begin(), status_changed_ids_.end(), component_id) == status_changed_ids_.end())
+                        status_changed_ids_.push_back(component_id);
                     break;
                 }
                 case static_cast<int>(daq::CoreEventId::AttributeChanged):
@@ -1601,21 +2364,81 @@ void OpenDAQNodeEditor::Render()
                                  SetNodeActiveRecursively(component_id);
                              }
                         }
-                        else if (attribute_name == "Visible" || attribute_name == "Name")
+                        else if (attribute_name == "Name")
                         {
-                            // yolo refresh, a massive overkill
-                            RebuildStructure();
+                            RenameComponent(comp);
                         }
                     }
                     break;
                 }
                 case static_cast<int>(daq::CoreEventId::PropertyValueChanged):
-                    if (args.getParameters().hasKey("Name"))
-                        properties_window_.on_property_changed_(comp.getGlobalId().toStdString(), args.getParameters().get("Name").toString());
-                    // fallthrough
+                {
+                    daq::DictPtr<daq::IString, daq::IBaseObject> params = args.getParameters();
+                    if (!params.hasKey("Name"))
+                    {
+                        properties_window_.FlagComponentsForResync();
+                        for (auto& w : cloned_properties_windows_)
+                            w->FlagComponentsForResync();
+                        break;
+                    }
+
+                    std::string component_id = comp.getGlobalId().toStdString();
+                    std::string property_name = params.get("Name").toString();
+                    properties_window_.on_property_changed_(component_id, property_name);
+
+                    // only the changed property is patched, windows pick it up through the component's properties_version_
+                    if (auto it = all_components_.find(component_id); it != all_components_.end() && it->second->initial_properties_loaded_)
+                    {
+                        std::string property_uid = property_name;
+                        if (params.hasKey("Path"))
+                        {
+                            std::string path = params.get("Path").toString();
+                            if (!path.empty())
+                                property_uid = path + "." + property_name;
+                        }
+                        daq::BaseObjectPtr value = params.hasKey("Value") ? params.get("Value") : daq::BaseObjectPtr();
+                        // a load in flight may already have read the old value, so it is reloaded once it lands
+                        if (it->second->IsLoadingProperties() || !it->second->RefreshPropertyValue(property_uid, value))
+                            it->second->needs_resync_ = true;
+                    }
+                    break;
+                }
+                case static_cast<int>(daq::CoreEventId::PropertyObjectUpdateEnd):
+                {
+                    // writes inside beginUpdate/endUpdate arrive as one event per component listing every changed property
+                    daq::DictPtr<daq::IString, daq::IBaseObject> params = args.getParameters();
+                    std::string component_id = comp.getGlobalId().toStdString();
+                    auto it = all_components_.find(component_id);
+                    if (it == all_components_.end() || !it->second->initial_properties_loaded_)
+                        break;
+
+                    bool patched = params.hasKey("UpdatedProperties") && !it->second->IsLoadingProperties();
+                    if (patched)
+                    {
+                        std::string path_prefix;
+                        if (params.hasKey("Path"))
+                        {
+                            std::string path = params.get("Path").toString();
+                            if (!path.empty())
+                                path_prefix = path + ".";
+                        }
+                        daq::DictPtr<daq::IString, daq::IBaseObject> updated = params.get("UpdatedProperties");
+                        for (const daq::StringPtr& name : updated.getKeyList())
+                        {
+                            properties_window_.on_property_changed_(component_id, name.toStdString());
+                            if (!it->second->RefreshPropertyValue(path_prefix + name.toStdString(), updated.get(name)))
+                                patched = false;
+                        }
+                    }
+                    if (!patched)
+                        it->second->needs_resync_ = true;
+                    break;
+                }
                 case static_cast<int>(daq::CoreEventId::PropertyAdded):
                 case static_cast<int>(daq::CoreEventId::PropertyRemoved):
                 {
+                    if (auto it = all_components_.find(comp.getGlobalId().toStdString()); it != all_components_.end())
+                        it->second->InvalidatePropertyMetadata();
                     properties_window_.FlagComponentsForResync();
                     for (auto& w : cloned_properties_windows_)
                         w->FlagComponentsForResync();
@@ -1627,6 +2450,12 @@ void OpenDAQNodeEditor::Render()
                     std::string signal_id = comp.getGlobalId().toStdString();
                     if (signals_.count(signal_id) > 0)
                         signals_[signal_id]->needs_resync_ = true;
+                    // descriptor lists are re-read the next time they are shown, including those of signals using this one as their domain
+                    for (const auto& [id, cached] : all_components_)
+                    {
+                        if (id == signal_id || cached->domain_signal_id_ == signal_id)
+                            cached->InvalidateDescriptorProperties();
+                    }
                     break;
                 }
                 case static_cast<int>(daq::CoreEventId::SignalConnected):
@@ -1653,39 +2482,41 @@ void OpenDAQNodeEditor::Render()
                     }
                     break;
                 }
-                case static_cast<int>(daq::CoreEventId::ComponentRemoved):
-                {
-                    daq::DictPtr<daq::IString, daq::IBaseObject> params = args.getParameters();
-                    if (params.hasKey("Id"))
-                    {
-                        std::string removed_local_id = params.get("Id");
-                        for (const auto& [id, cached] : all_components_)
-                        {
-                            if (cached->parent_ == comp && cached->component_.assigned() && cached->component_.getLocalId() == removed_local_id)
-                            {
-                                if (canCastTo<daq::IDevice>(cached->component_))
-                                {
-                                    std::string name = cached->component_.getName().toStdString();
-                                    ImGui::InsertNotification({ImGuiToastType::Warning, DEFAULT_NOTIFICATION_DURATION_MS, "Device disconnected: %s", name.c_str()});
-                                }
-                                break;
-                            }
-                        }
-                    }
-                    RebuildStructure();
-                    break;
-                }
-                case static_cast<int>(daq::CoreEventId::ComponentAdded):
-                case static_cast<int>(daq::CoreEventId::ComponentUpdateEnd):
-                {
-                    RebuildStructure();
-                    break;
-                }
             }
         }
-        event_id_queue_.clear();
     }
 
+    if (showing_topology_snapshot_ && !startup_device_.valid() && pending_topologies_.empty())
+        DropStaleNodes();
+
+    for (const std::string& component_id : status_changed_ids_)
+    {
+        auto it = folders_.find(component_id);
+        if (it == folders_.end())
+            continue;
+
+        CachedComponent* cached = it->second;
+        std::string previous_error = cached->error_message_;
+        std::string previous_warning = cached->warning_message_;
+        cached->RefreshStatus();
+        if (!cached->error_message_.empty())
+        {
+            nodes_.SetError(component_id, cached->error_message_);
+            if (cached->error_message_ != previous_error)
+                status_notifications_.Post(true, "'" + cached->name_ + "' error: " + cached->error_message_);
+        }
+        else if (!cached->warning_message_.empty())
+        {
+            nodes_.SetWarning(component_id, cached->warning_message_);
+            if (cached->warning_message_ != previous_warning)
+                status_notifications_.Post(false, "'" + cached->name_ + "' warning: " + cached->warning_message_);
+        }
+        else
+            nodes_.SetOk(component_id);
+    }
+    status_changed_ids_.clear();
+    status_notifications_.Update();
+
     properties_window_.Render();
     for (auto it = cloned_properties_windows_.begin(); it != cloned_properties_windows_.end(); )
     {
@@ -1701,11 +2532,15 @@ void OpenDAQNodeEditor::Render()
     {
         (*it)->Render();
         if (!(*it)->is_open_)
+        {
+            if ((*it)->IsExporting())
+                detached_exports_.push_back((*it)->TakeExport());
             it = cloned_signals_windows_.erase(it);
+        }
         else
             ++it;
     }
-    tree_view_window_.Render(all_components_[instance_.getGlobalId().toStdString()].get(), all_components_);
+    tree_view_window_.Render(components_by_handle_[instance_handle_], components_by_handle_);
 
     if (ImGui::Begin("Nodes", nullptr, ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse))
     {
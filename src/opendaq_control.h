@@ -5,6 +5,10 @@
 #include "component_cache.h"
 #include "signals_window.h"
 #include "tree_view_window.h"
+#include "notification_aggregator.h"
+#include "function_block_catalog.h"
+#include "device_discovery.h"
+#include "signal_preview_pool.h"
 #include <vector>
 #include <optional>
 #include <string>
@@ -18,9 +22,54 @@ class OpenDAQNodeEditor
 {
 public:
     OpenDAQNodeEditor();
+    ~OpenDAQNodeEditor();
     void Init();
     void InitImGui();
+    // A subtree read on a worker thread, component only for a device whose subtree is still being read by its own worker
+    struct StagedTopology
+    {
+        daq::ComponentPtr component;
+        std::unique_ptr<CachedComponent> cached;
+        std::vector<std::unique_ptr<CachedComponent>> input_ports;
+        std::vector<std::unique_ptr<CachedComponent>> signals;
+        std::vector<std::unique_ptr<StagedTopology>> children;
+    };
+    struct PendingTopology
+    {
+        std::future<std::unique_ptr<StagedTopology>> staged;
+        std::string parent_id;
+        daq::ComponentPtr owner;
+        std::string root_id;
+    };
     void RetrieveTopology(daq::ComponentPtr component, std::string parent_id = "", daq::ComponentPtr owner = nullptr);
+    // Fills the caches and nodes from a staged subtree on the UI thread, placeholders are handed to workers
+    void MergeTopology(StagedTopology& staged, std::string parent_id, daq::ComponentPtr owner);
+    void PollPendingTopologies();
+    void ApplyPendingState();
+
+    // Nodes and connections of the last session, shown stale at startup until the live topology has been read
+    struct TopologySnapshot
+    {
+        struct Node
+        {
+            std::string id;
+            std::string parent_id;
+            std::string name;
+            int color_index;
+            std::vector<ImGui::ImGuiNodesIdentifier> inputs;
+            std::vector<ImGui::ImGuiNodesIdentifier> outputs;
+        };
+        std::string connection_string;
+        std::vector<Node> nodes;
+        std::vector<std::pair<std::string, std::string>> connections; // signal id, input port id
+    };
+    TopologySnapshot TakeTopologySnapshot() const;
+    void ShowTopologySnapshot();
+    // Stale nodes the live topology did not take over are gone from the device
+    void DropStaleNodes();
+    // Connects the device given on the command line on a worker, so the window is up before it is in
+    void AddStartupDevice(const std::string& connection_string);
+    void PollStartupDevice();
     void OnConnectionCreated(const ImGui::ImGuiNodesUid& output_id, const ImGui::ImGuiNodesUid& input_id);
     void OnConnectionRemoved(const ImGui::ImGuiNodesUid& input_id);
     void OnOutputHover(const ImGui::ImGuiNodesUid& id);
@@ -35,9 +84,21 @@ public:
     void OnEmptySpaceClick(ImVec2 position);
     void RenderNestedNodePopup();
     void ShowStartupPopup();
-    void RetrieveConnections();
+    void RetrieveConnections(const std::string& subtree_id = "");
     void RebuildNodeConnections(const std::string& node_id);
     void RebuildStructure();
+    // Smallest cached subtree that has to be re-walked for a change to component, nullptr if only RebuildStructure will do
+    daq::ComponentPtr FindPatchRoot(daq::ComponentPtr component);
+    bool RemovalChangesSurvivingNode(daq::ComponentPtr folder) const;
+    void PatchTopology(daq::ComponentPtr root);
+    // Updates the cached name, the node and the lists showing it in place
+    void RenameComponent(daq::ComponentPtr component);
+    // Drops the cached components and nodes of a subtree, returns the nodes that were only unembedded from it
+    std::vector<ImGui::ImGuiNodesUid> RemoveTopology(const std::string& root_id);
+    // The cached components of a subtree, found through the child lists rather than by scanning every id
+    std::vector<CachedComponent*> CollectSubtree(const std::string& root_id) const;
+    std::string FindNodeParentId(daq::ComponentPtr component) const;
+    void RestoreWindowSelections();
     void RebuildNodeGeometry();
     void Render();
     void SetNodeActiveRecursively(const std::string& node_id);
@@ -49,10 +110,18 @@ public:
     void BuildPopupParentCandidates(const std::string& parent_guid, int depth = 0, int parent_color_index = 0);
 
     daq::InstancePtr instance_;
+    std::vector<std::future<std::unique_ptr<CachedComponent>>> abandoned_property_loads_; // see CachedComponent::abandoned_property_loads_
     std::unordered_map<std::string, std::unique_ptr<CachedComponent>> all_components_;
     std::unordered_map<std::string, CachedComponent*> folders_;
     std::unordered_map<std::string, CachedComponent*> input_ports_;
     std::unordered_map<std::string, CachedComponent*> signals_;
+    ComponentsByHandle components_by_handle_; // same components as all_components_, for lookups on per-frame paths
+    ComponentHandle instance_handle_ = INVALID_COMPONENT_HANDLE;
+    // handles of the cached components by the handle of their parent_, e.g. the FBs hidden inside a channel
+    std::unordered_map<ComponentHandle, std::vector<ComponentHandle>> components_by_parent_;
+    // Adds a component to all_components_, components_by_handle_ and components_by_parent_
+    CachedComponent* CacheComponent(std::unique_ptr<CachedComponent> cached);
+    void UncacheParent(const CachedComponent* cached);
 
     std::vector<std::string> selected_ids_;
     
@@ -61,20 +130,17 @@ public:
 
     daq::ComponentPtr dragged_input_port_component_;
 
-    struct DiscoveredDeviceEntry
-    {
-        std::string name;
-        std::string connection_string;
-    };
+    SignalPreviewPool signal_previews_;
+    PropertyWriteQueue property_writes_;
+    std::vector<SignalExporter> detached_exports_; // of closed signals windows, polled until they are written
+    std::string hovered_output_id_;
 
-    std::vector<DiscoveredDeviceEntry> discovered_devices_sorted_;
-    std::future<std::vector<DiscoveredDeviceEntry>> device_discovery_future_;
-    bool is_device_discovery_initialized_ = false;
-    bool auto_refresh_devices_ = true;
-    std::chrono::steady_clock::time_point last_refresh_time_;
+    // one per parent device, created the first time its device list is shown and kept so the list opens warm
+    std::unordered_map<std::string, std::unique_ptr<DeviceDiscovery>> device_discoveries_;
+    DeviceDiscovery& GetDeviceDiscovery(const daq::DevicePtr& parent_device);
+    bool use_mock_discovery_ = false; // adds fake devices to the instance's list
 
-    bool fb_options_cache_valid_ = false;
-    daq::DictPtr<daq::IString, daq::IFunctionBlockType> cached_available_fbs_;
+    FunctionBlockCatalog function_block_catalog_;
     std::string popup_selected_parent_guid_;
     struct PopupParentCandidate
     {
@@ -85,6 +151,7 @@ public:
         int depth;
     };
     std::vector<PopupParentCandidate> popup_parent_candidates_;
+    uint64_t popup_parent_candidates_version_ = 0; // catalog version the candidates were built with
 
     ImGui::ImGuiNodes nodes_;
 
@@ -109,10 +176,35 @@ public:
 
     std::mutex event_mutex_;
     std::vector<std::pair<daq::ComponentPtr, daq::CoreEventArgsPtr>> event_id_queue_;
+    std::vector<std::string> status_changed_ids_; // coalesced StatusChanged events of the current frame
+
+    // One frame of core events with the redundant ones collapsed: structural changes are reduced to non-nested
+    // subtrees, and events that only depend on the latest value keep just the last one per component
+    struct CoreEventBatch
+    {
+        bool rebuild_structure = false;
+        std::vector<std::string> removed_ids;
+        std::vector<daq::ComponentPtr> patch_roots;
+        std::vector<std::pair<daq::ComponentPtr, daq::CoreEventArgsPtr>> events;
+    };
+    CoreEventBatch ReduceCoreEvents(std::vector<std::pair<daq::ComponentPtr, daq::CoreEventArgsPtr>>& events);
+    void ApplyStructuralChanges(const CoreEventBatch& batch);
+
+    CoreEventStats core_event_stats_;
+    NotificationAggregator status_notifications_{"status changes"};
 
     // Pending state loaded from INI, applied after first RebuildStructure
     std::vector<std::string> pending_selected_ids_;
     bool has_pending_state_ = false;
+
+    std::string startup_connection_string_;
+    std::future<void> startup_device_;
+    TopologySnapshot topology_snapshot_; // as loaded from INI, kept while its nodes are still shown
+    bool is_topology_snapshot_checked_ = false;
+    bool showing_topology_snapshot_ = false;
+
+    std::vector<PendingTopology> pending_topologies_;
+    std::vector<std::future<std::unique_ptr<StagedTopology>>> abandoned_topologies_; // from a structure that was rebuilt meanwhile
     std::vector<std::unique_ptr<PropertiesWindow>> pending_cloned_properties_;
     std::vector<std::unique_ptr<SignalsWindow>> pending_cloned_signals_;
 };
@@ -44,10 +44,48 @@ static void BeginComponentDragSource(PropertiesWindow* window, CachedComponent*
     }
 }
 
+// Applies a finished background load and (re)starts one when the cached properties are missing or stale
+static void EnsurePropertiesLoaded(CachedComponent* component)
+{
+    component->PollPropertiesLoad();
+    if ((component->needs_resync_ || !component->initial_properties_loaded_) && !component->IsLoadingProperties())
+        component->BeginPropertiesLoad();
+    if (component->descriptor_properties_requested_ && !component->descriptor_properties_loaded_)
+        component->RefreshDescriptorProperties();
+}
+
+// Asks for the descriptor lists once their tab is actually on screen, EnsurePropertiesLoaded then reads them
+static void RequestDescriptorProperties(SharedCachedComponent& shared_cached_component)
+{
+    if (!ImGui::IsRectVisible(ImVec2(ImGui::GetContentRegionAvail().x, ImGui::GetFrameHeight())))
+        return;
+    for (CachedComponent* comp : shared_cached_component.source_components_)
+    {
+        if (!comp->descriptor_properties_loaded_)
+            comp->descriptor_properties_requested_ = true;
+    }
+}
+
+
+// Interned names compare by address, so the string's address identifies the name
+struct PropertyKey
+{
+    const std::string* name;
+    daq::CoreType type;
+
+    bool operator==(const PropertyKey& other) const { return name == other.name && type == other.type; }
+};
+
+struct PropertyKeyHash
+{
+    size_t operator()(const PropertyKey& key) const { return std::hash<const void*>()(key.name) ^ ((size_t)key.type * 0x9e3779b97f4a7c15ull); }
+};
 
 SharedCachedComponent::SharedCachedComponent(const std::vector<CachedComponent*>& components, const std::string& group_name)
 {
     source_components_ = components;
+    for (CachedComponent* component : components)
+        source_versions_.push_back(component->properties_version_);
     if (components.empty())
         return;
 
@@ -64,9 +102,23 @@ SharedCachedComponent::SharedCachedComponent(const std::vector<CachedComponent*>
 
     CachedComponent* base = components[0];
 
+    // one name+type index per other component, so each base property is matched in O(1) per component
+    std::vector<std::unordered_map<PropertyKey, CachedProperty*, PropertyKeyHash>> indices(components.size());
+
     auto merge_list = [&](std::vector<CachedProperty> CachedComponent::* list, std::vector<SharedCachedProperty>& target_list)
     {
+        for (size_t i = 1; i < components.size(); ++i)
+        {
+            std::vector<CachedProperty>& other_list = components[i]->*list;
+            indices[i].clear();
+            indices[i].reserve(other_list.size());
+            // emplace keeps the first property of a name, same as the linear search used to
+            for (CachedProperty& prop : other_list)
+                indices[i].emplace(PropertyKey{&prop.name_.str(), prop.type_}, &prop);
+        }
+
         std::vector<CachedProperty>& base_list = base->*list;
+        target_list.reserve(base_list.size());
         for (CachedProperty& base_prop : base_list)
         {
             bool found_in_all_components = true;
@@ -76,39 +128,34 @@ SharedCachedComponent::SharedCachedComponent(const std::vector<CachedComponent*>
             std::optional<double> final_max = base_prop.max_value_;
 
             std::vector<CachedProperty*> targets;
+            targets.reserve(components.size());
             targets.push_back(&base_prop);
 
+            const PropertyKey key{&base_prop.name_.str(), base_prop.type_};
             for (size_t i = 1; i < components.size(); ++i)
             {
-                bool matching_property_found = false;
-                std::vector<CachedProperty>& other_list = components[i]->*list;
-                for (CachedProperty& prop : other_list)
+                auto it = indices[i].find(key);
+                if (it == indices[i].end())
                 {
-                    if (!(prop.name_ == base_prop.name_ && prop.type_ == base_prop.type_))
-                        continue;
+                    found_in_all_components = false;
+                    break;
+                }
 
-                    matching_property_found = true;
-                    if (prop.value_ != base_prop.value_)
-                        same_value_in_all_components = false;
+                CachedProperty& prop = *it->second;
+                if (prop.value_ != base_prop.value_)
+                    same_value_in_all_components = false;
 
-                    if (prop.min_value_.has_value())
-                    {
-                        if (!final_min.has_value() || prop.min_value_.value() > final_min.value())
-                            final_min = prop.min_value_;
-                    }
-                    if (prop.max_value_.has_value())
-                    {
-                        if (!final_max.has_value() || prop.max_value_.value() < final_max.value())
-                            final_max = prop.max_value_;
-                    }
-                    targets.push_back(&prop);
-                    break;
+                if (prop.min_value_.has_value())
+                {
+                    if (!final_min.has_value() || prop.min_value_.value() > final_min.value())
+                        final_min = prop.min_value_;
                 }
-                if (!matching_property_found)
+                if (prop.max_value_.has_value())
                 {
-                    found_in_all_components = false;
-                    break;
+                    if (!final_max.has_value() || prop.max_value_.value() < final_max.value())
+                        final_max = prop.max_value_;
                 }
+                targets.push_back(&prop);
             }
 
             if (found_in_all_components)
@@ -117,9 +164,9 @@ SharedCachedComponent::SharedCachedComponent(const std::vector<CachedComponent*>
                 static_cast<CachedProperty&>(new_prop) = base_prop;
                 new_prop.min_value_ = final_min;
                 new_prop.max_value_ = final_max;
-                new_prop.target_properties_ = targets;
+                new_prop.target_properties_ = std::move(targets);
                 new_prop.is_multi_value_ = !same_value_in_all_components;
-                target_list.push_back(new_prop);
+                target_list.push_back(std::move(new_prop));
             }
         }
     };
@@ -130,6 +177,16 @@ SharedCachedComponent::SharedCachedComponent(const std::vector<CachedComponent*>
     merge_list(&CachedComponent::signal_domain_descriptor_properties_, signal_domain_descriptor_properties_);
 }
 
+bool SharedCachedComponent::IsOutdated() const
+{
+    // needs_resync_ is left to EnsurePropertiesLoaded, the view only goes stale once the new properties landed
+    for (size_t i = 0; i < source_components_.size(); ++i)
+    {
+        if (source_components_[i]->properties_version_ != source_versions_[i])
+            return true;
+    }
+    return false;
+}
 
 PropertiesWindow::PropertiesWindow(const PropertiesWindow& other)
 {
@@ -144,6 +201,9 @@ PropertiesWindow::PropertiesWindow(const PropertiesWindow& other)
     on_reselect_click_ = other.on_reselect_click_;
     on_property_changed_ = other.on_property_changed_;
     all_components_ = other.all_components_;
+    components_by_handle_ = other.components_by_handle_;
+    property_writes_ = other.property_writes_;
+    core_event_stats_ = other.core_event_stats_;
     group_components_ = other.group_components_;
 
     RebuildComponents();
@@ -316,19 +376,21 @@ void PropertiesWindow::RenderProperty(SharedCachedProperty& cached_prop, SharedC
 
     auto SetValue = [&](const CachedProperty::ValueType& val)
     {
-        for (CachedProperty* target : cached_prop.target_properties_)
-            target->SetValue(val);
-
         cached_prop.value_ = val;
         cached_prop.is_multi_value_ = false;
 
-        if (on_property_changed_)
+        // the queue reports each write once it has been applied, a background write lands frames later
+        if (property_writes_)
         {
-            for (CachedProperty* target : cached_prop.target_properties_)
-            {
-                if (target->owner_)
-                    on_property_changed_(target->owner_->uid_, target->name_);
-            }
+            property_writes_->Write(cached_prop.target_properties_, val);
+            return;
+        }
+
+        for (CachedProperty* target : cached_prop.target_properties_)
+        {
+            target->SetValue(val);
+            if (on_property_changed_ && target->owner_)
+                on_property_changed_(target->owner_->uid_, target->name_);
         }
     };
 
@@ -425,14 +487,15 @@ void PropertiesWindow::RenderProperty(SharedCachedProperty& cached_prop, SharedC
             }
             break;
         case daq::ctObject:
-            ImGui::Text("%s", cached_prop.display_name_.c_str());
-            break;
         case daq::ctStruct:
+            // keeps headers as tall as the value rows, RenderPropertyRows relies on that
+            ImGui::AlignTextToFramePadding();
             ImGui::Text("%s", cached_prop.display_name_.c_str());
             break;
         default:
             {
                 std::string n = "!Unsupported prop t" + std::to_string((int)cached_prop.type_) + ": " + cached_prop.display_name_;
+                ImGui::AlignTextToFramePadding();
                 ImGui::Text("%s", n.c_str());
                 break;
             }
@@ -493,6 +556,54 @@ void PropertiesWindow::RenderProperty(SharedCachedProperty& cached_prop, SharedC
     ImGui::PopID();
 }
 
+// functions and procedures expand in place, every other property is a single frame-high row
+static bool HasFixedRowHeight(const SharedCachedProperty& cached_prop)
+{
+    return cached_prop.type_ != daq::ctProc && cached_prop.type_ != daq::ctFunc;
+}
+
+void PropertiesWindow::RenderPropertyRows(std::vector<SharedCachedProperty>& properties, SharedCachedComponent* owner)
+{
+    // nested properties are already flattened with their depth, so the list only needs the hidden rows filtered out
+    std::vector<SharedCachedProperty*>& rows = property_rows_;
+    rows.clear();
+    for (SharedCachedProperty& cached_prop : properties)
+    {
+        if (show_debug_properties_ || !cached_prop.is_debug_property_)
+            rows.push_back(&cached_prop);
+    }
+
+    // runs of fixed-height rows go through the clipper so only the visible ones are submitted,
+    // variable-height rows in between are rendered as they are
+    const float row_height = ImGui::GetFrameHeightWithSpacing();
+    size_t begin = 0;
+    while (begin < rows.size())
+    {
+        size_t end = begin;
+        while (end < rows.size() && HasFixedRowHeight(*rows[end]))
+            end++;
+
+        if (end > begin && !clip_property_rows_)
+        {
+            for (size_t i = begin; i < end; ++i)
+                RenderProperty(*rows[i], owner);
+        }
+        else if (end > begin)
+        {
+            ImGuiListClipper clipper;
+            clipper.Begin((int)(end - begin), row_height);
+            while (clipper.Step())
+            {
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+                    RenderProperty(*rows[begin + i], owner);
+            }
+        }
+        if (end < rows.size())
+            RenderProperty(*rows[end++], owner);
+        begin = end;
+    }
+}
+
 void PropertiesWindow::AddGroupedComponentsTooltip(SharedCachedComponent& shared_cached_component)
 {
     if (!group_components_ || !ImGui::IsItemHovered())
@@ -536,31 +647,57 @@ void PropertiesWindow::RenderComponent(SharedCachedComponent& shared_cached_comp
         }
     }
 
-    for (SharedCachedProperty& cached_attr : shared_cached_component.attributes_)
-        RenderProperty(cached_attr, &shared_cached_component);
+    bool is_loading = false;
+    for (CachedComponent* comp : shared_cached_component.source_components_)
+    {
+        if (!comp->initial_properties_loaded_)
+            is_loading = true;
+    }
+    if (is_loading)
+    {
+        ImGui::TextDisabled("Loading properties%s", &"..."[2 - (int)(ImGui::GetTime() * 3.0) % 3]);
+        return;
+    }
+    if (show_debug_properties_)
+    {
+        for (CachedComponent* comp : shared_cached_component.source_components_)
+        {
+            if (comp->properties_load_ms_ >= 0)
+                ImGui::TextDisabled("%s loaded in %.0f ms (metadata cached for %zu of %zu properties)", comp->name_.c_str(), comp->properties_load_ms_,
+                                    comp->property_metadata_hits_, comp->property_metadata_hits_ + comp->property_metadata_misses_);
+        }
+    }
 
-    for (SharedCachedProperty& cached_prop : shared_cached_component.properties_)
-        RenderProperty(cached_prop, &shared_cached_component);
+    RenderPropertyRows(shared_cached_component.attributes_, &shared_cached_component);
+    RenderPropertyRows(shared_cached_component.properties_, &shared_cached_component);
 
-    if (!shared_cached_component.signal_descriptor_properties_.empty() || !shared_cached_component.signal_domain_descriptor_properties_.empty())
+    bool is_signal = !shared_cached_component.source_components_.empty();
+    bool descriptors_loaded = true;
+    for (CachedComponent* comp : shared_cached_component.source_components_)
+    {
+        is_signal &= comp->is_signal_;
+        descriptors_loaded &= comp->descriptor_properties_loaded_;
+    }
+    if (is_signal)
     {
         if (ImGui::BeginTabBar("SignalDescriptors"))
         {
-            if (!shared_cached_component.signal_descriptor_properties_.empty())
+            // until the descriptors are read it is unknown whether there is a domain signal, so both tabs are offered
+            if (!descriptors_loaded || !shared_cached_component.signal_descriptor_properties_.empty())
             {
                 if (ImGui::BeginTabItem("Signal Descriptor"))
                 {
-                    for (SharedCachedProperty& cached_prop : shared_cached_component.signal_descriptor_properties_)
-                        RenderProperty(cached_prop, &shared_cached_component);
+                    RequestDescriptorProperties(shared_cached_component);
+                    RenderPropertyRows(shared_cached_component.signal_descriptor_properties_, &shared_cached_component);
                     ImGui::EndTabItem();
                 }
             }
-            if (!shared_cached_component.signal_domain_descriptor_properties_.empty())
+            if (!descriptors_loaded || !shared_cached_component.signal_domain_descriptor_properties_.empty())
             {
                 if (ImGui::BeginTabItem("Domain Signal Descriptor"))
                 {
-                    for (SharedCachedProperty& cached_prop : shared_cached_component.signal_domain_descriptor_properties_)
-                        RenderProperty(cached_prop, &shared_cached_component);
+                    RequestDescriptorProperties(shared_cached_component);
+                    RenderPropertyRows(shared_cached_component.signal_domain_descriptor_properties_, &shared_cached_component);
                     ImGui::EndTabItem();
                 }
             }
@@ -575,41 +712,34 @@ void PropertiesWindow::RenderChildren(SharedCachedComponent& shared_cached_compo
         return;
 
     CachedComponent* base = shared_cached_component.source_components_[0];
-    if (!all_components_ || base->children_.empty())
+    if (!components_by_handle_ || base->children_.empty())
         return;
 
     ImGui::Indent();
-    for (const ImGui::ImGuiNodesIdentifier& child_id_struct : base->children_)
+    for (ComponentHandle child_handle : base->children_)
     {
-        std::string child_id = child_id_struct.id_;
-        auto it = all_components_->find(child_id);
-        if (it == all_components_->end())
+        CachedComponent* child = (*components_by_handle_)[child_handle];
+        if (!child)
             continue;
 
-        CachedComponent* child = it->second.get();
-        if (child->needs_resync_ || !child->initial_properties_loaded_)
-        {
-            child->RefreshProperties();
-            child->needs_resync_ = false;
-        }
-
         // skip folders that are just for structure
         if (child->name_ == "IO" || child->name_ == "AI" || child->name_ == "AO" || child->name_ == "Dev" || child->name_ == "FB")
         {
             ImGui::Unindent();
-            SharedCachedComponent shared_child({child});
-            RenderChildren(shared_child);
+            RenderChildren(GetComponentView(child));
             ImGui::Indent();
         }
         else
         {
-            ImGui::PushID(child_id.c_str());
+            ImGui::PushID(child->uid_.c_str());
             ImGui::PushStyleColor(ImGuiCol_Header, ImGui::GetStyleColorVec4(ImGuiCol_Tab));
             bool child_open = ImGui::CollapsingHeader((child->name_ + "###" + child->uid_).c_str());
             BeginComponentDragSource(this, child);
             if (child_open)
             {
-                SharedCachedComponent shared_child({child});
+                // children are only loaded once they are expanded
+                EnsurePropertiesLoaded(child);
+                SharedCachedComponent& shared_child = GetComponentView(child);
                 RenderComponent(shared_child, false);
                 if (show_parents_and_children_ && !group_components_)
                     RenderChildren(shared_child);
@@ -623,44 +753,34 @@ void PropertiesWindow::RenderChildren(SharedCachedComponent& shared_cached_compo
 
 void PropertiesWindow::RenderComponentWithParents(SharedCachedComponent& shared_cached_component)
 {
-    if (!show_parents_and_children_ || group_components_ || !all_components_)
+    if (!show_parents_and_children_ || group_components_ || !components_by_handle_)
     {
         RenderComponent(shared_cached_component);
         return;
     }
 
     std::vector<CachedComponent*> parent_components;
-    daq::ComponentPtr current_parent_ptr = shared_cached_component.source_components_[0]->parent_;
-    while (current_parent_ptr.assigned())
+    for (ComponentHandle parent_handle = shared_cached_component.source_components_[0]->parent_handle_;
+         CachedComponent* parent = (*components_by_handle_)[parent_handle];
+         parent_handle = parent->parent_handle_)
     {
-        std::string id = current_parent_ptr.getGlobalId().toStdString();
-        auto it = all_components_->find(id);
-        if (it == all_components_->end())
-            break;
-
-        parent_components.push_back(it->second.get());
-        current_parent_ptr = it->second->parent_;
+        parent_components.push_back(parent);
     }
 
     for (auto it = parent_components.rbegin(); it != parent_components.rend(); ++it)
     {
-        if ((*it)->needs_resync_ || !(*it)->initial_properties_loaded_)
-        {
-            (*it)->RefreshProperties();
-            (*it)->needs_resync_ = false;
-        }
+        EnsurePropertiesLoaded(*it);
 
         if ((*it)->name_ == "IO" || (*it)->name_ == "AI" || (*it)->name_ == "AO" || (*it)->name_ == "Dev" || (*it)->name_ == "FB")
             continue;
 
-        ImGui::PushID((*it)->component_.getGlobalId().toStdString().c_str());
+        ImGui::PushID((*it)->uid_.c_str());
         ImGui::PushStyleColor(ImGuiCol_Header, ImGui::GetStyleColorVec4(ImGuiCol_Tab));
         bool parent_open = ImGui::CollapsingHeader((*it)->name_.c_str());
         BeginComponentDragSource(this, *it);
         if (parent_open)
         {
-             SharedCachedComponent parent_component({*it});
-             RenderComponent(parent_component, false);
+             RenderComponent(GetComponentView(*it), false);
         }
         ImGui::PopStyleColor(1);
         ImGui::PopID();
@@ -675,6 +795,15 @@ void PropertiesWindow::OnSelectionChanged(const std::vector<std::string>& select
     if (freeze_selection_)
         return;
 
+    // loads for components that just got deselected are stale, any other window still showing them restarts its own
+    for (const std::string& id : selected_component_ids_)
+    {
+        if (std::find(selected_ids.begin(), selected_ids.end(), id) != selected_ids.end())
+            continue;
+        if (auto it = all_components.find(id); it != all_components.end() && !it->second->initial_properties_loaded_)
+            it->second->CancelPropertiesLoad();
+    }
+
     selected_component_ids_ = selected_ids;
     RestoreSelection(all_components);
 }
@@ -784,7 +913,19 @@ void PropertiesWindow::Render()
     if (ImGui::Button(show_debug_properties_ ? ICON_FA_BUG " " ICON_FA_TOGGLE_ON : ICON_FA_BUG " " ICON_FA_TOGGLE_OFF))
         show_debug_properties_ = !show_debug_properties_;
     if (ImGui::IsItemHovered())
-        ImGui::SetTooltip(show_debug_properties_ ? "Hide debug properties" : "Show debug properties");
+    {
+        if (show_debug_properties_ && all_components_)
+        {
+            CachedComponent::MemoryReport report = CachedComponent::BuildMemoryReport(*all_components_);
+            CoreEventStats events = core_event_stats_ ? *core_event_stats_ : CoreEventStats();
+            ImGui::SetTooltip("Hide debug properties\n\n%zu cached properties, %zu interned strings\nProperty strings: %.1f KiB (%.1f KiB without interning)\n"
+                              "Core events: %llu received, %llu applied",
+                              report.properties, report.interned_strings, report.interned_bytes / 1024.0, report.per_property_bytes / 1024.0,
+                              (unsigned long long)events.received, (unsigned long long)events.applied);
+        }
+        else
+            ImGui::SetTooltip(show_debug_properties_ ? "Hide debug properties" : "Show debug properties");
+    }
 
 
     if (grouped_selected_components_.empty())
@@ -830,6 +971,8 @@ void PropertiesWindow::Render()
             if (!auto_fit_this_frame)
                 ImGui::BeginChild("##ContentScrollRegion", ImVec2(0, 0), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar);
 
+            // the columns size themselves to their widest row, so every row has to be submitted
+            clip_property_rows_ = false;
             int uid = 0;
             for (auto& comp : grouped_selected_components_)
             {
@@ -838,6 +981,7 @@ void PropertiesWindow::Render()
                 ImGui::EndChild();
                 ImGui::SameLine();
             }
+            clip_property_rows_ = true;
 
             if (!auto_fit_this_frame)
                 ImGui::EndChild();
@@ -846,11 +990,10 @@ void PropertiesWindow::Render()
         bool needs_rebuild = false;
         for (auto& comp : grouped_selected_components_)
         {
-            for (auto* source : comp.source_components_)
-            {
-                if (source->needs_resync_)
-                    needs_rebuild = true;
-            }
+            for (CachedComponent* source : comp.source_components_)
+                EnsurePropertiesLoaded(source);
+            if (comp.IsOutdated())
+                needs_rebuild = true;
         }
         if (needs_rebuild)
             RebuildComponents();
@@ -896,9 +1039,19 @@ void PropertiesWindow::Render()
     ImGui::End();
 }
 
+SharedCachedComponent& PropertiesWindow::GetComponentView(CachedComponent* component)
+{
+    std::unique_ptr<SharedCachedComponent>& view = component_views_[component];
+    if (!view || view->IsOutdated())
+        view = std::make_unique<SharedCachedComponent>(std::vector<CachedComponent*>{component});
+    return *view;
+}
+
 void PropertiesWindow::RebuildComponents()
 {
     grouped_selected_components_.clear();
+    // components may have been destroyed since, so the pointer keys can not be trusted anymore
+    component_views_.clear();
     if (selected_component_ids_.empty() || !all_components_)
         return;
 
@@ -908,11 +1061,7 @@ void PropertiesWindow::RebuildComponents()
         if (auto it = all_components_->find(id); it != all_components_->end())
         {
             CachedComponent* comp = it->second.get();
-            if (comp->needs_resync_ || (!comp->initial_properties_loaded_))
-            {
-                comp->RefreshProperties();
-                comp->needs_resync_ = false;
-            }
+            EnsurePropertiesLoaded(comp);
             all_selected_components.push_back(comp);
         }
     }
@@ -940,7 +1089,7 @@ void PropertiesWindow::RebuildComponents()
     else
     {
         for (CachedComponent* comp : all_selected_components)
-            component_groups[comp->component_.getGlobalId().toStdString()].push_back(comp);
+            component_groups[comp->uid_].push_back(comp);
     }
 
     for (auto& [type_id, components] : component_groups)
@@ -24,7 +24,10 @@ struct SharedCachedComponent
     std::vector<SharedCachedProperty> signal_domain_descriptor_properties_;
 
     std::vector<CachedComponent*> source_components_;
+    std::vector<uint64_t> source_versions_; // properties_version_ of each source when this view was merged
     bool needs_resync_ = false;
+
+    bool IsOutdated() const;
 };
 
 
@@ -63,6 +66,9 @@ public:
 
     std::vector<std::string> selected_component_ids_;
     const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>* all_components_ = nullptr;
+    const ComponentsByHandle* components_by_handle_ = nullptr; // owned by the node editor, for per-frame lookups
+    PropertyWriteQueue* property_writes_ = nullptr; // owned by the node editor, takes edits of many properties at once
+    const CoreEventStats* core_event_stats_ = nullptr; // owned by the node editor, shown in the debug tooltip
     bool freeze_selection_ = false;
     bool show_parents_and_children_ = true;
     bool tabbed_interface_ = true;
@@ -76,11 +82,17 @@ private:
     void RebuildComponents();
     
     void RenderProperty(SharedCachedProperty& cached_prop, SharedCachedComponent* owner);
+    void RenderPropertyRows(std::vector<SharedCachedProperty>& properties, SharedCachedComponent* owner);
 
     void RenderComponent(SharedCachedComponent& component, bool draw_header = true);
     void AddGroupedComponentsTooltip(SharedCachedComponent& shared_cached_component);
     void RenderComponentWithParents(SharedCachedComponent& component);
     void RenderChildren(SharedCachedComponent& component);
+    // Merged single-component view of a parent or child, kept until the component changes
+    SharedCachedComponent& GetComponentView(CachedComponent* component);
     
     std::vector<SharedCachedComponent> grouped_selected_components_;
+    std::unordered_map<CachedComponent*, std::unique_ptr<SharedCachedComponent>> component_views_;
+    bool clip_property_rows_ = true;
+    std::vector<SharedCachedProperty*> property_rows_; // scratch buffer of RenderPropertyRows, reused between calls
 };
@@ -1,7 +1,34 @@
 #include "signal.h"
 #include "utils.h"
+#include <algorithm>
 
 
+void SlidingWindowExtremes::Push(double time_seconds, double min, double max)
+{
+    while (!min_deque_.empty() && min_deque_.back().value >= min)
+        min_deque_.pop_back();
+    min_deque_.push_back({time_seconds, min});
+
+    while (!max_deque_.empty() && max_deque_.back().value <= max)
+        max_deque_.pop_back();
+    max_deque_.push_back({time_seconds, max});
+}
+
+void SlidingWindowExtremes::ExpireBefore(double time_seconds)
+{
+    // never expire the newest point so a stalled signal keeps its last extremes
+    while (min_deque_.size() > 1 && min_deque_.front().time_seconds < time_seconds)
+        min_deque_.pop_front();
+    while (max_deque_.size() > 1 && max_deque_.front().time_seconds < time_seconds)
+        max_deque_.pop_front();
+}
+
+void SlidingWindowExtremes::Clear()
+{
+    min_deque_.clear();
+    max_deque_.clear();
+}
+
 OpenDAQSignal::OpenDAQSignal(daq::SignalPtr signal, float seconds_shown, int max_points)
     : seconds_shown_(seconds_shown)
     , max_points_(max_points)
@@ -9,14 +36,50 @@ OpenDAQSignal::OpenDAQSignal(daq::SignalPtr signal, float seconds_shown, int max
     RebuildIfInvalid(signal, seconds_shown, max_points);
 }
 
+bool OpenDAQSignal::HasConfiguration(float seconds_shown, int max_points) const
+{
+    return std::abs(seconds_shown - seconds_shown_) < 1e-5 && max_points == max_points_;
+}
+
 void OpenDAQSignal::UpdateConfiguration(float seconds_shown, int max_points)
 {
-    if (std::abs(seconds_shown - seconds_shown_) < 1e-5 && max_points == max_points_)
+    if (HasConfiguration(seconds_shown, max_points))
         return;
 
     RebuildIfInvalid(signal_, seconds_shown, max_points);
 }
 
+int OpenDAQSignal::FindPlotIndex(double time_seconds) const
+{
+    const size_t capacity = plot_times_seconds_.size();
+    const size_t count = std::min(points_in_plot_buffer_, capacity);
+    if (count == 0 || !axes_.empty())
+        return -1;
+
+    // binary search over the logical (oldest to newest) order of the ring buffer
+    const size_t first = (pos_in_plot_buffer_ + capacity - count) % capacity;
+    auto time_at = [&](size_t i) { return plot_times_seconds_[(first + i) % capacity]; };
+    size_t lo = 0, hi = count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (time_at(mid) < time_seconds)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == count)
+        lo = count - 1;
+    else if (lo > 0 && time_seconds - time_at(lo - 1) < time_at(lo) - time_seconds)
+        lo--;
+
+    // outside the buffered range, the edge point is not a value under the cursor
+    const double plot_sample_spacing = samples_per_second_ > 0 ? samples_per_plot_sample_ / samples_per_second_ : 0.0;
+    if (std::abs(time_at(lo) - time_seconds) > plot_sample_spacing)
+        return -1;
+    return (int)((first + lo) % capacity);
+}
+
 static std::int64_t getApproximateSampleRate(const daq::DataDescriptorPtr& dataDescriptor)
 {
     const auto resolution = dataDescriptor.getTickResolution().simplify();
@@ -46,6 +109,7 @@ void OpenDAQSignal::RebuildIfInvalid(daq::SignalPtr signal, float seconds_shown,
     pos_in_plot_buffer_ = 0;
     start_time_ = -1;
     points_in_plot_buffer_ = 0;
+    visible_extremes_.Clear();
     end_time_seconds_ = 0;
 
     signal_name_ = signal.getName().toStdString();
@@ -122,6 +186,7 @@ void OpenDAQSignal::RebuildIfInvalid(daq::SignalPtr signal, float seconds_shown,
     } catch (...)
     {
     }
+    samples_per_second_ = samples_per_second;
     samples_per_plot_sample_ = std::max<int>(1, (int)std::ceil((double)samples_per_second * seconds_shown / (float)max_points));
 
     if (auto value_range = signal.getDescriptor().getValueRange(); value_range.assigned())
@@ -189,6 +254,21 @@ void OpenDAQSignal::RebuildIfInvalid(daq::SignalPtr signal)
     RebuildIfInvalid(signal, seconds_shown_, max_points_);
 }
 
+std::shared_ptr<void> OpenDAQSignal::SubscribeRawSamples(RawSampleListener listener)
+{
+    std::shared_ptr<void> token = std::make_shared<char>();
+    raw_sample_listeners_.push_back({token, std::move(listener)});
+    return token;
+}
+
+bool OpenDAQSignal::HasRawSampleSubscription(const std::shared_ptr<void>& token) const
+{
+    // compares ownership, so a token is never mistaken for a later one that reuses its address
+    return std::any_of(raw_sample_listeners_.begin(), raw_sample_listeners_.end(),
+                       [&](const RawSampleSubscription& subscription)
+                       { return !subscription.token.owner_before(token) && !token.owner_before(subscription.token); });
+}
+
 void OpenDAQSignal::Update()
 {
     if (reader_ == nullptr || !reader_.assigned())
@@ -239,6 +319,17 @@ void OpenDAQSignal::ReadDomainAndValue()
         if (read_count == 0)
             break;
 
+        for (auto it = raw_sample_listeners_.begin(); it != raw_sample_listeners_.end(); )
+        {
+            if (it->token.expired())
+            {
+                it = raw_sample_listeners_.erase(it);
+                continue;
+            }
+            it->listener(read_values.data() + leftover_samples_, read_count);
+            ++it;
+        }
+
         read_count += leftover_samples_;
         
         if (start_time_ == -1)
@@ -259,6 +350,7 @@ void OpenDAQSignal::ReadDomainAndValue()
             }
             plot_values_avg_[pos_in_plot_buffer_] = plot_values_avg_[pos_in_plot_buffer_] / samples_per_plot_sample_;
             end_time_seconds_ = plot_times_seconds_[pos_in_plot_buffer_];
+            visible_extremes_.Push(end_time_seconds_, plot_values_min_[pos_in_plot_buffer_], plot_values_max_[pos_in_plot_buffer_]);
             pos_in_plot_buffer_ += 1; if (pos_in_plot_buffer_ >= plot_values_avg_.size()) pos_in_plot_buffer_ = 0;
             points_in_plot_buffer_ = std::min(points_in_plot_buffer_ + 1, plot_values_avg_.size());
         }
@@ -271,6 +363,7 @@ void OpenDAQSignal::ReadDomainAndValue()
         }
         leftover_samples_ = new_leftover_samples;
     }
+    visible_extremes_.ExpireBefore(end_time_seconds_ - seconds_shown_);
 }
 
 void OpenDAQSignal::ReadDomainOnly()
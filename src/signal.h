@@ -4,6 +4,9 @@
 #include <variant>
 #include <vector>
 #include <string>
+#include <functional>
+#include <deque>
+#include <memory>
 
 
 enum class SignalType
@@ -12,6 +15,27 @@ enum class SignalType
     DomainAndValue
 };
 
+// Minimum and maximum over a sliding time window, kept in monotonic deques so each point costs O(1) amortized
+class SlidingWindowExtremes
+{
+public:
+    void Push(double time_seconds, double min, double max);
+    void ExpireBefore(double time_seconds);
+    void Clear();
+    bool Empty() const { return min_deque_.empty(); }
+    double Min() const { return min_deque_.front().value; }
+    double Max() const { return max_deque_.front().value; }
+
+private:
+    struct Entry
+    {
+        double time_seconds;
+        double value;
+    };
+    std::deque<Entry> min_deque_; // increasing values, oldest first
+    std::deque<Entry> max_deque_; // decreasing values, oldest first
+};
+
 class OpenDAQSignal
 {
 public:
@@ -22,6 +46,9 @@ public:
     void RebuildIfInvalid(daq::SignalPtr signal, float seconds_shown, int max_points);
     void RebuildIfInvalid(daq::SignalPtr signal);
     void RebuildIfInvalid();
+    bool HasConfiguration(float seconds_shown, int max_points) const;
+    // Index into the plot buffers of the point closest to time_seconds, or -1 if there is none within one plot sample
+    int FindPlotIndex(double time_seconds) const;
 
     std::vector<double> plot_values_avg_;
     std::vector<double> plot_values_min_;
@@ -30,6 +57,7 @@ public:
     double end_time_seconds_ = 0;
     size_t pos_in_plot_buffer_ = 0;
     size_t points_in_plot_buffer_ = 0;
+    SlidingWindowExtremes visible_extremes_; // min/max over the last seconds_shown_ of plot points
 
     std::string signal_name_{""};
     std::string signal_id_{""};
@@ -41,6 +69,21 @@ public:
 
     float seconds_shown_ = 5.0f;
     int max_points_ = 2000;
+    double samples_per_second_ = 1;
+
+    // Calls the listener with every chunk of raw (non-decimated) values read from a domain+value signal, for as long
+    // as the returned token is held by the subscriber
+    using RawSampleListener = std::function<void(const double* values, size_t count)>;
+    std::shared_ptr<void> SubscribeRawSamples(RawSampleListener listener);
+    bool HasRawSampleSubscription(const std::shared_ptr<void>& token) const;
+
+    struct RawSampleSubscription
+    {
+        std::weak_ptr<void> token;
+        RawSampleListener listener;
+    };
+    std::vector<RawSampleSubscription> raw_sample_listeners_;
+    int last_update_frame_ = -1;
 
     struct Axis
     {
@@ -0,0 +1,156 @@
+#include "signal_export.h"
+#include "signal.h"
+#include <fstream>
+#include <algorithm>
+#include <cstdint>
+
+
+// binary layout: magic, uint32 signal count, then per signal: uint32 name length, name, uint32 unit length, unit,
+// uint64 point count and the times/avg/min/max columns as consecutive arrays of native doubles
+static constexpr char BINARY_MAGIC[8] = {'O', 'D', 'Q', 'G', 'E', 'X', 'P', '1'};
+// rows written between progress updates
+static constexpr std::size_t PROGRESS_STEP = 4096;
+
+
+SignalSnapshot TakeSnapshot(const OpenDAQSignal& signal)
+{
+    SignalSnapshot snapshot;
+    snapshot.name = signal.signal_name_;
+    snapshot.unit = signal.signal_unit_;
+
+    const std::size_t capacity = signal.plot_times_seconds_.size();
+    if (!signal.axes_.empty() || capacity == 0
+        || signal.plot_values_avg_.size() != capacity || signal.plot_values_min_.size() != capacity || signal.plot_values_max_.size() != capacity)
+        return snapshot;
+
+    // unroll the ring buffer into two contiguous ranges: [first, capacity) followed by [0, first + count - capacity)
+    const std::size_t count = std::min(signal.points_in_plot_buffer_, capacity);
+    const std::size_t first = (signal.pos_in_plot_buffer_ + capacity - count) % capacity;
+    const std::size_t head = std::min(count, capacity - first);
+    auto unroll = [&](const std::vector<double>& ring, std::vector<double>& out)
+        {
+            out.reserve(count);
+            out.insert(out.end(), ring.begin() + first, ring.begin() + first + head);
+            out.insert(out.end(), ring.begin(), ring.begin() + (count - head));
+        };
+    unroll(signal.plot_times_seconds_, snapshot.times_seconds);
+    unroll(signal.plot_values_avg_, snapshot.values_avg);
+    unroll(signal.plot_values_min_, snapshot.values_min);
+    unroll(signal.plot_values_max_, snapshot.values_max);
+    return snapshot;
+}
+
+static std::string CsvEscape(const std::string& text)
+{
+    if (text.find_first_of(",\"\n") == std::string::npos)
+        return text;
+
+    std::string escaped = "\"";
+    for (char c : text)
+    {
+        if (c == '"')
+            escaped += '"';
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+static void WriteCsv(std::ofstream& out, const std::vector<SignalSnapshot>& snapshots, std::atomic<std::size_t>& written)
+{
+    out << "signal,unit,time_s,avg,min,max\n";
+    out.precision(17);
+    for (const SignalSnapshot& snapshot : snapshots)
+    {
+        const std::string name = CsvEscape(snapshot.name);
+        const std::string unit = CsvEscape(snapshot.unit);
+        for (std::size_t i = 0; i < snapshot.times_seconds.size(); ++i)
+        {
+            out << name << ',' << unit << ',' << snapshot.times_seconds[i] << ','
+                << snapshot.values_avg[i] << ',' << snapshot.values_min[i] << ',' << snapshot.values_max[i] << '\n';
+            if ((i + 1) % PROGRESS_STEP == 0)
+                written += PROGRESS_STEP;
+        }
+        written += snapshot.times_seconds.size() % PROGRESS_STEP;
+    }
+}
+
+static void WriteBinary(std::ofstream& out, const std::vector<SignalSnapshot>& snapshots, std::atomic<std::size_t>& written)
+{
+    auto write_u32 = [&](uint32_t value) { out.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    auto write_u64 = [&](uint64_t value) { out.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    auto write_string = [&](const std::string& text)
+        {
+            write_u32((uint32_t)text.size());
+            out.write(text.data(), (std::streamsize)text.size());
+        };
+    auto write_column = [&](const std::vector<double>& column)
+        {
+            out.write(reinterpret_cast<const char*>(column.data()), (std::streamsize)(column.size() * sizeof(double)));
+        };
+
+    out.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    write_u32((uint32_t)snapshots.size());
+    for (const SignalSnapshot& snapshot : snapshots)
+    {
+        write_string(snapshot.name);
+        write_string(snapshot.unit);
+        write_u64(snapshot.times_seconds.size());
+        write_column(snapshot.times_seconds);
+        write_column(snapshot.values_avg);
+        write_column(snapshot.values_min);
+        write_column(snapshot.values_max);
+        written += snapshot.times_seconds.size();
+    }
+}
+
+bool SignalExporter::Start(std::vector<SignalSnapshot>&& snapshots, const std::string& path, ExportFormat format)
+{
+    if (IsRunning())
+        return false;
+
+    path_ = path;
+    progress_ = std::make_shared<ProgressState>();
+    for (const SignalSnapshot& snapshot : snapshots)
+        progress_->total += snapshot.times_seconds.size();
+
+    future_ = std::async(std::launch::async, [snapshots = std::move(snapshots), path, format, progress = progress_]() -> std::string
+        {
+            std::ofstream out(path, format == ExportFormat::Binary ? std::ios::out | std::ios::binary : std::ios::out);
+            if (!out)
+                return "Could not open " + path;
+
+            if (format == ExportFormat::Binary)
+                WriteBinary(out, snapshots, progress->written);
+            else
+                WriteCsv(out, snapshots, progress->written);
+
+            out.close();
+            if (!out)
+                return "Failed writing " + path;
+            return "";
+        });
+    return true;
+}
+
+float SignalExporter::Progress() const
+{
+    if (!progress_ || progress_->total == 0)
+        return IsRunning() ? 0.0f : 1.0f;
+    return std::min(1.0f, (float)progress_->written.load() / (float)progress_->total);
+}
+
+bool SignalExporter::PollFinished(std::string& error)
+{
+    if (!future_.valid() || future_.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return false;
+
+    try
+    {
+        error = future_.get();
+    }
+    catch (const std::exception& e)
+    {
+        error = e.what();
+    }
+    return true;
+}
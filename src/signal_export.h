@@ -0,0 +1,51 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <future>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+class OpenDAQSignal;
+
+enum class ExportFormat
+{
+    Csv,
+    Binary
+};
+
+// Chronologically ordered copy of a signal's decimated plot buffers
+struct SignalSnapshot
+{
+    std::string name;
+    std::string unit;
+    std::vector<double> times_seconds;
+    std::vector<double> values_avg;
+    std::vector<double> values_min;
+    std::vector<double> values_max;
+};
+
+SignalSnapshot TakeSnapshot(const OpenDAQSignal& signal);
+
+// Writes snapshots to a file on a background thread. Start/Progress/PollFinished are called from the UI thread.
+class SignalExporter
+{
+public:
+    bool Start(std::vector<SignalSnapshot>&& snapshots, const std::string& path, ExportFormat format);
+    bool IsRunning() const { return future_.valid(); }
+    float Progress() const;
+    // Returns true once the export has finished, error is empty on success
+    bool PollFinished(std::string& error);
+
+    std::string path_;
+
+private:
+    struct ProgressState
+    {
+        std::atomic<std::size_t> written{0};
+        std::size_t total = 0;
+    };
+
+    std::future<std::string> future_;
+    std::shared_ptr<ProgressState> progress_;
+};
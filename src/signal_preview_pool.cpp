@@ -0,0 +1,70 @@
+#include "signal_preview_pool.h"
+
+
+std::list<SignalPreviewPool::Entry>::iterator SignalPreviewPool::Insert(const daq::SignalPtr& signal, std::list<Entry>::iterator position)
+{
+    auto it = entries_.insert(position, {OpenDAQSignal(signal, seconds_shown_, max_points_), std::chrono::steady_clock::now()});
+    entries_by_id_[it->reader.signal_id_] = it;
+    while (entries_.size() > capacity_)
+    {
+        auto last = std::prev(entries_.end());
+        if (last == it)
+            break;
+        entries_by_id_.erase(last->reader.signal_id_);
+        entries_.erase(last);
+    }
+    return it;
+}
+
+OpenDAQSignal& SignalPreviewPool::Acquire(const daq::SignalPtr& signal)
+{
+    std::string id = signal.getGlobalId().toStdString();
+    if (auto found = entries_by_id_.find(id); found != entries_by_id_.end())
+    {
+        entries_.splice(entries_.begin(), entries_, found->second);
+        found->second->last_used = std::chrono::steady_clock::now();
+        return found->second->reader;
+    }
+    return Insert(signal, entries_.begin())->reader;
+}
+
+void SignalPreviewPool::Prewarm(const std::vector<daq::SignalPtr>& signals)
+{
+    // behind the most recently used one, so prewarming never evicts the preview being shown
+    for (const daq::SignalPtr& signal : signals)
+    {
+        if (entries_by_id_.find(signal.getGlobalId().toStdString()) == entries_by_id_.end())
+            Insert(signal, entries_.empty() ? entries_.end() : std::next(entries_.begin()));
+    }
+}
+
+void SignalPreviewPool::Update()
+{
+    auto idle_before = std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(idle_seconds_));
+    for (auto it = entries_.begin(); it != entries_.end(); )
+    {
+        if (it->last_used < idle_before)
+        {
+            entries_by_id_.erase(it->reader.signal_id_);
+            it = entries_.erase(it);
+            continue;
+        }
+        it->reader.Update();
+        ++it;
+    }
+}
+
+void SignalPreviewPool::Remove(const std::string& signal_id)
+{
+    if (auto found = entries_by_id_.find(signal_id); found != entries_by_id_.end())
+    {
+        entries_.erase(found->second);
+        entries_by_id_.erase(found);
+    }
+}
+
+void SignalPreviewPool::Clear()
+{
+    entries_by_id_.clear();
+    entries_.clear();
+}
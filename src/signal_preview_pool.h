@@ -0,0 +1,41 @@
+#pragma once
+#include "signal.h"
+#include <opendaq/opendaq.h>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <chrono>
+
+
+// Readers for the hover previews of recently hovered outputs and their neighbours. Pooled readers keep reading
+// every frame, so a preview already has its short history when it is shown. The least recently used reader is
+// dropped when the pool is full, and readers nobody hovered for a while are dropped so idle signals stop streaming.
+class SignalPreviewPool
+{
+public:
+    // The reader of the signal, created if it is not pooled yet
+    OpenDAQSignal& Acquire(const daq::SignalPtr& signal);
+    // Creates readers for the signals that are not pooled yet, without bumping the ones that are
+    void Prewarm(const std::vector<daq::SignalPtr>& signals);
+    // Reads all pooled signals and drops the idle ones, called once per frame
+    void Update();
+    void Remove(const std::string& signal_id);
+    void Clear();
+
+    size_t capacity_ = 8;
+    float seconds_shown_ = 2.0f;
+    int max_points_ = 800;
+    float idle_seconds_ = 30.0f;
+
+private:
+    struct Entry
+    {
+        OpenDAQSignal reader;
+        std::chrono::steady_clock::time_point last_used;
+    };
+    std::list<Entry>::iterator Insert(const daq::SignalPtr& signal, std::list<Entry>::iterator position);
+
+    std::list<Entry> entries_; // most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> entries_by_id_;
+};
@@ -4,11 +4,18 @@
 #include "imgui.h"
 #include "imgui_internal.h"
 #include "implot.h"
+#include "imgui_stdlib.h"
+#include "ImGuiNotify.hpp"
 #include <algorithm>
 #include <unordered_set>
+#include <limits>
+#include <ctime>
+#include <cmath>
+#include <cstdio>
 
 
 static constexpr const char* SIG_DND_TYPE = "SIG_DND";
+static constexpr double AUTO_FIT_SHRINK_SECONDS = 0.5;
 static SignalsWindow* s_sig_dnd_source = nullptr;
 
 
@@ -16,7 +23,7 @@ SignalsWindow::SignalsWindow(const SignalsWindow& other)
 {
     for (const auto& [id, signal] : other.signals_map_)
     {
-        signals_map_[id] = { OpenDAQSignal(signal.live.signal_, other.seconds_shown_), OpenDAQSignal(), signal.color };
+        signals_map_[id] = { signal.live, OpenDAQSignal(), signal.color };
     }
 
     is_cloned_ = true;
@@ -27,6 +34,7 @@ SignalsWindow::SignalsWindow(const SignalsWindow& other)
     total_min_ = other.total_min_;
     total_max_ = other.total_max_;
     seconds_shown_ = other.seconds_shown_;
+    overview_mode_ = other.overview_mode_;
     plot_unique_id_ = other.plot_unique_id_;
     on_reselect_click_ = other.on_reselect_click_;
 }
@@ -58,7 +66,7 @@ void SignalsWindow::RestoreSelection(const std::unordered_map<std::string, std::
                         color = it->second->signal_color_.value();
                 }
 
-                signals_map_[signal_id] = { OpenDAQSignal(signal, seconds_shown_), OpenDAQSignal(), color };
+                signals_map_[signal_id] = { std::make_shared<OpenDAQSignal>(signal, seconds_shown_), OpenDAQSignal(), color };
 
                 if (subplots_.empty())
                     subplots_.emplace_back();
@@ -104,9 +112,9 @@ void SignalsWindow::RestoreSelection(const std::unordered_map<std::string, std::
 
     for (auto it = signals_map_.begin(); it != signals_map_.end(); )
     {
-        if (std::find(selected_signal_ids.begin(), selected_signal_ids.end(), it->second.live.signal_id_) == selected_signal_ids.end())
+        if (std::find(selected_signal_ids.begin(), selected_signal_ids.end(), it->second.live->signal_id_) == selected_signal_ids.end())
         {
-            std::string id_to_remove = it->second.live.signal_id_;
+            std::string id_to_remove = it->second.live->signal_id_;
             for (auto& subplot : subplots_)
             {
                 auto& ids = subplot.signal_ids;
@@ -125,8 +133,8 @@ void SignalsWindow::RestoreSelection(const std::unordered_map<std::string, std::
     total_max_ = std::numeric_limits<float>::lowest();
     for (auto& [_, signal] : signals_map_)
     {
-        total_min_ = std::min(total_min_, signal.live.value_range_min_);
-        total_max_ = std::max(total_max_, signal.live.value_range_max_);
+        total_min_ = std::min(total_min_, signal.live->value_range_min_);
+        total_max_ = std::max(total_max_, signal.live->value_range_max_);
     }
     if (was_empty && !signals_map_.empty())
         plot_unique_id_ += 1;
@@ -181,7 +189,10 @@ void SignalsWindow::Render()
         if (is_paused_)
         {
             for (auto& [_, signal] : signals_map_)
-                signal.paused = signal.live;
+            {
+                signal.paused = *signal.live;
+                signal.paused.raw_sample_listeners_.clear();
+            }
         }
     }
     if (ImGui::IsItemHovered())
@@ -196,6 +207,36 @@ void SignalsWindow::Render()
         seconds_shown_ = ImClamp(temp_seconds_shown, 0.1f, 3600.0f);
     }
 
+    ImGui::SameLine();
+    ImGui::BeginDisabled(signals_map_.empty());
+    if (ImGui::Button(overview_mode_ ? ICON_FA_CHART_LINE : ICON_FA_GRIP_LINES))
+        overview_mode_ = !overview_mode_;
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip(overview_mode_ ? "Show signals in plots" : "Show signals as dense overview strips");
+    ImGui::EndDisabled();
+
+    ImGui::SameLine();
+    ImGui::BeginDisabled(signals_map_.empty() || overview_mode_);
+    const char* cursor_icons[] = { ICON_FA_CROSSHAIRS, ICON_FA_CROSSHAIRS " 1", ICON_FA_CROSSHAIRS " 2" };
+    if (ImGui::Button(cursor_icons[(int)cursor_mode_]))
+    {
+        cursor_mode_ = (CursorMode)(((int)cursor_mode_ + 1) % 3);
+        if (cursor_mode_ == CursorMode::Delta)
+        {
+            cursor_offsets_seconds_[0] = seconds_shown_ * 0.75;
+            cursor_offsets_seconds_[1] = seconds_shown_ * 0.25;
+        }
+    }
+    if (ImGui::IsItemHovered())
+    {
+        const char* cursor_tooltips[] = { "Show measurement cursor", "Show two measurement cursors", "Hide measurement cursors" };
+        ImGui::SetTooltip("%s", cursor_tooltips[(int)cursor_mode_]);
+    }
+    ImGui::EndDisabled();
+
+    ImGui::SameLine();
+    RenderExport();
+
     if (signals_map_.empty())
     {
         ImGui::Text("No signals found on selected components");
@@ -216,7 +257,7 @@ void SignalsWindow::Render()
                         if (src_it != source->signals_map_.end())
                         {
                             auto& src_signal = src_it->second;
-                            signals_map_[signal_id] = { OpenDAQSignal(src_signal.live.signal_, seconds_shown_), OpenDAQSignal(), src_signal.color };
+                            signals_map_[signal_id] = { src_signal.live, OpenDAQSignal(), src_signal.color };
                             subplots_.emplace_back();
                             subplots_.back().signal_ids.push_back(signal_id);
                         }
@@ -244,13 +285,84 @@ void SignalsWindow::Render()
         return;
     }
 
+    SyncSpectrumAnalyzers();
+
+    const int frame = ImGui::GetFrameCount();
     for (auto& [_, signal] : signals_map_)
-        signal.live.Update();
+    {
+        // a shared signal is read once per frame, by whichever window gets to it first
+        if (signal.live->last_update_frame_ == frame)
+            continue;
+        signal.live->last_update_frame_ = frame;
+        signal.live->Update();
+    }
 
     int max_points = std::max((int)ImGui::GetIO().DisplaySize.x, 100);
     for (auto& [_, signal] : signals_map_)
-        signal.live.UpdateConfiguration(seconds_shown_, max_points);
+    {
+        if (signal.live.use_count() > 1 && !signal.live->HasConfiguration(seconds_shown_, max_points))
+        {
+            // other windows keep the shared history, this one gets its own reader for the different time span;
+            // the analyzer leaves the shared signal here and subscribes to the new one on the next sync
+            if (signal.spectrum)
+                signal.spectrum->subscription_.reset();
+            signal.live = std::make_shared<OpenDAQSignal>(signal.live->signal_, seconds_shown_, max_points);
+            continue;
+        }
+        signal.live->UpdateConfiguration(seconds_shown_, max_points);
+    }
+
+    if (overview_mode_)
+        RenderOverview();
+    else
+        RenderSubplots();
 
+    // Window-level drop target for cross-window signal drops (fallback for empty areas)
+    {
+        const ImGuiPayload* active_payload = ImGui::GetDragDropPayload();
+        if (active_payload && active_payload->IsDataType(SIG_DND_TYPE) && s_sig_dnd_source && s_sig_dnd_source != this)
+        {
+            ImGuiWindow* window = ImGui::GetCurrentWindow();
+            if (ImGui::BeginDragDropTargetCustom(window->InnerRect, window->ID))
+            {
+                if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(SIG_DND_TYPE))
+                {
+                    std::string signal_id = (const char*)payload->Data;
+                    SignalsWindow* source = s_sig_dnd_source;
+                    auto src_it = source->signals_map_.find(signal_id);
+                    if (src_it != source->signals_map_.end() && !signals_map_.count(signal_id))
+                    {
+                        auto& src_signal = src_it->second;
+                        signals_map_[signal_id] = { src_signal.live, OpenDAQSignal(), src_signal.color };
+                        if (subplots_.empty())
+                            subplots_.emplace_back();
+                        subplots_[0].signal_ids.push_back(signal_id);
+                    }
+                    if (source->is_cloned_)
+                    {
+                        source->signals_map_.erase(signal_id);
+                        for (auto& s : source->subplots_)
+                        {
+                            auto& ids = s.signal_ids;
+                            ids.erase(std::remove(ids.begin(), ids.end(), signal_id), ids.end());
+                        }
+                        source->subplots_.erase(std::remove_if(source->subplots_.begin(), source->subplots_.end(),
+                                                               [](const Subplot& s) { return s.signal_ids.empty(); }),
+                                                source->subplots_.end());
+                    }
+                    if (is_cloned_)
+                        freeze_selection_ = true;
+                }
+                ImGui::EndDragDropTarget();
+            }
+        }
+    }
+
+    ImGui::End();
+}
+
+void SignalsWindow::RenderSubplots()
+{
     float drop_height = 0.0f;
     if (const ImGuiPayload* payload = ImGui::GetDragDropPayload(); payload && payload->IsDataType(SIG_DND_TYPE))
         drop_height = 40.0f;
@@ -264,67 +376,102 @@ void SignalsWindow::Render()
 
     for (auto& subplot : subplots_)
     {
-        if (ImPlot::BeginPlot(("##SignalsWindow" + std::to_string(plot_unique_id_) + "_" + std::to_string(subplot.uid)).c_str(), ImVec2(-1, plot_height)))
+        const bool is_spectrum = subplot.type == SubplotType::Spectrum;
+        std::string plot_id = "##SignalsWindow" + std::to_string(plot_unique_id_) + "_" + std::to_string(subplot.uid) + (is_spectrum ? "_fft" : "");
+        if (ImPlot::BeginPlot(plot_id.c_str(), ImVec2(-1, plot_height)))
         {
             bool is_multi_dim = false;
-            std::string x_label = "Time";
-            for (const auto& id : subplot.signal_ids)
+            if (is_spectrum)
+            {
+                ImPlot::SetupAxes("Frequency [Hz]", "Amplitude [dB]", flags | ImPlotAxisFlags_AutoFit, flags | ImPlotAxisFlags_AutoFit);
+            }
+            else
             {
-                if (signals_map_.count(id))
+                std::string x_label = "Time";
+                for (const auto& id : subplot.signal_ids)
                 {
-                    auto& signal = signals_map_[id];
-                    OpenDAQSignal& to_check = is_paused_ ? signal.paused : signal.live;
-
-                    if (!to_check.axes_.empty())
+                    if (signals_map_.count(id))
                     {
-                        is_multi_dim = true;
-                        x_label = to_check.axes_[0].name_;
-                        if (!to_check.axes_[0].unit_.empty())
-                            x_label += " [" + to_check.axes_[0].unit_ + "]";
-                        break;
+                        auto& signal = signals_map_[id];
+                        OpenDAQSignal& to_check = is_paused_ ? signal.paused : *signal.live;
+
+                        if (!to_check.axes_.empty())
+                        {
+                            is_multi_dim = true;
+                            x_label = to_check.axes_[0].name_;
+                            if (!to_check.axes_[0].unit_.empty())
+                                x_label += " [" + to_check.axes_[0].unit_ + "]";
+                            break;
+                        }
                     }
                 }
-            }
 
-            ImPlot::SetupAxes(x_label.c_str(), nullptr, flags, flags);
-            if (!is_multi_dim)
-                ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Time);
+                ImPlot::SetupAxes(x_label.c_str(), nullptr, flags, flags);
+                if (!is_multi_dim)
+                    ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Time);
 
-            double max_end_time = 0;
-            float sub_min = std::numeric_limits<float>::max();
-            float sub_max = std::numeric_limits<float>::lowest();
-            bool has_signals = false;
+                double max_end_time = 0;
+                float sub_min = std::numeric_limits<float>::max();
+                float sub_max = std::numeric_limits<float>::lowest();
+                double data_min = std::numeric_limits<double>::max();
+                double data_max = std::numeric_limits<double>::lowest();
+                bool has_signals = false;
 
-            for (const auto& id : subplot.signal_ids)
-            {
-                if (signals_map_.find(id) == signals_map_.end()) continue;
-                has_signals = true;
-                auto& signal = signals_map_[id];
-                OpenDAQSignal& to_plot = is_paused_ ? signal.paused : signal.live;
-                max_end_time = ImMax(max_end_time, to_plot.end_time_seconds_);
+                for (const auto& id : subplot.signal_ids)
+                {
+                    if (signals_map_.find(id) == signals_map_.end()) continue;
+                    has_signals = true;
+                    auto& signal = signals_map_[id];
+                    OpenDAQSignal& to_plot = is_paused_ ? signal.paused : *signal.live;
+                    max_end_time = ImMax(max_end_time, to_plot.end_time_seconds_);
 
-                sub_min = std::min(sub_min, to_plot.value_range_min_);
-                sub_max = std::max(sub_max, to_plot.value_range_max_);
-            }
+                    sub_min = std::min(sub_min, to_plot.value_range_min_);
+                    sub_max = std::max(sub_max, to_plot.value_range_max_);
+                    if (!to_plot.visible_extremes_.Empty())
+                    {
+                        data_min = std::min(data_min, to_plot.visible_extremes_.Min());
+                        data_max = std::max(data_max, to_plot.visible_extremes_.Max());
+                    }
+                }
 
-            if (!has_signals) { sub_min = 0; sub_max = 1; }
+                if (!has_signals) { sub_min = 0; sub_max = 1; }
 
-            if (!is_multi_dim)
-                ImPlot::SetupAxisLimits(ImAxis_X1, max_end_time - seconds_shown_, max_end_time, ImGuiCond_Always);
-            ImPlot::SetupAxisLimits(ImAxis_Y1, sub_min, sub_max);
+                if (!is_multi_dim)
+                    ImPlot::SetupAxisLimits(ImAxis_X1, max_end_time - seconds_shown_, max_end_time, ImGuiCond_Always);
+                if (subplot.auto_fit_y && !is_multi_dim && data_min <= data_max)
+                {
+                    UpdateAutoFitLimits(subplot, data_min, data_max);
+                    ImPlot::SetupAxisLimits(ImAxis_Y1, subplot.fit_y_min, subplot.fit_y_max, ImGuiCond_Always);
+                }
+                else
+                {
+                    subplot.fit_y_valid = false;
+                    ImPlot::SetupAxisLimits(ImAxis_Y1, sub_min, sub_max);
+                }
+            }
 
             for (const auto& id : subplot.signal_ids)
             {
                 if (signals_map_.find(id) == signals_map_.end()) continue;
                 auto& signal = signals_map_[id];
-                OpenDAQSignal& to_plot = is_paused_ ? signal.paused : signal.live;
+                OpenDAQSignal& to_plot = is_paused_ ? signal.paused : *signal.live;
 
                 std::string label = to_plot.signal_name_;
                 if (!to_plot.signal_unit_.empty())
                     label += " [" + to_plot.signal_unit_ + "]";
                 label += "##" + to_plot.signal_id_;
 
-                if (!to_plot.axes_.empty())
+                if (is_spectrum)
+                {
+                    if (signal.spectrum)
+                    {
+                        if (!is_paused_)
+                            signal.spectrum->PollResult();
+                        ImPlot::SetNextLineStyle(signal.color);
+                        ImPlot::PlotLine(label.c_str(), signal.spectrum->frequencies_.data(), signal.spectrum->magnitudes_db_.data(), (int)signal.spectrum->magnitudes_db_.size());
+                    }
+                }
+                else if (!to_plot.axes_.empty())
                 {
                     auto& axis = to_plot.axes_[0];
                     ImPlot::SetNextLineStyle(signal.color);
@@ -352,11 +499,14 @@ void SignalsWindow::Render()
                     ImGui::SetDragDropPayload(SIG_DND_TYPE, id.c_str(), id.size() + 1);
                     ImGui::ColorButton("##SignalColor", signal.color, ImGuiColorEditFlags_NoTooltip | ImGuiColorEditFlags_NoDragDrop | ImGuiColorEditFlags_NoOptions, ImVec2(ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()));
                     ImGui::SameLine();
-                    ImGui::Text("%s%s", signal.live.signal_name_.c_str() , signal.live.signal_unit_.empty() ? "" : (" [" + signal.live.signal_unit_ + "]").c_str());
+                    ImGui::Text("%s%s", signal.live->signal_name_.c_str() , signal.live->signal_unit_.empty() ? "" : (" [" + signal.live->signal_unit_ + "]").c_str());
                     ImPlot::EndDragDropSource();
                 }
             }
 
+            if (!is_spectrum && !is_multi_dim && cursor_mode_ != CursorMode::Off)
+                RenderCursors(subplot);
+
             if (ImPlot::BeginDragDropTargetPlot())
             {
                 if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(SIG_DND_TYPE))
@@ -395,7 +545,7 @@ void SignalsWindow::Render()
                                 if (src_it != source->signals_map_.end() && !signals_map_.count(signal_id))
                                 {
                                     auto& src_signal = src_it->second;
-                                    signals_map_[signal_id] = { OpenDAQSignal(src_signal.live.signal_, seconds_shown_), OpenDAQSignal(), src_signal.color };
+                                    signals_map_[signal_id] = { src_signal.live, OpenDAQSignal(), src_signal.color };
                                     for (auto& s : subplots_)
                                     {
                                         if (s.uid == target_uid)
@@ -425,7 +575,14 @@ void SignalsWindow::Render()
                 ImPlot::EndDragDropTarget();
             }
 
+            ImVec2 plot_pos = ImPlot::GetPlotPos();
+            ImVec2 plot_size = ImPlot::GetPlotSize();
             ImPlot::EndPlot();
+
+            // the options button is overlaid on the plot, so restore the layout cursor directly afterwards
+            ImVec2 cursor_after_plot = ImGui::GetCurrentWindow()->DC.CursorPos;
+            RenderSubplotOptions(subplot, ImVec2(plot_pos.x + plot_size.x, plot_pos.y));
+            ImGui::GetCurrentWindow()->DC.CursorPos = cursor_after_plot;
         }
     }
 
@@ -462,7 +619,7 @@ void SignalsWindow::Render()
                             if (src_it != source->signals_map_.end() && !signals_map_.count(signal_id))
                             {
                                 auto& src_signal = src_it->second;
-                                signals_map_[signal_id] = { OpenDAQSignal(src_signal.live.signal_, seconds_shown_), OpenDAQSignal(), src_signal.color };
+                                signals_map_[signal_id] = { src_signal.live, OpenDAQSignal(), src_signal.color };
                                 subplots_.push_back(Subplot({signal_id}));
                             }
                             if (source->is_cloned_)
@@ -488,62 +645,465 @@ void SignalsWindow::Render()
 
     if (deferred_action)
         deferred_action();
+}
 
-    // Window-level drop target for cross-window signal drops (fallback for empty areas)
+static constexpr const char* MISSING_CURSOR_VALUE = "—";
+
+// Value at a plot index from FindPlotIndex, or a dash when the cursor is not over buffered data
+static void RenderCursorValue(const std::vector<double>& values, int index)
+{
+    if (index >= 0)
+        ImGui::Text("%.6g", values[index]);
+    else
+        ImGui::TextUnformatted(MISSING_CURSOR_VALUE);
+}
+
+static std::string FormatCursorTime(double time_seconds)
+{
+    std::time_t whole_seconds = (std::time_t)std::floor(time_seconds);
+    int milliseconds = (int)((time_seconds - std::floor(time_seconds)) * 1000.0);
+    char buf[64];
+    if (const std::tm* utc = std::gmtime(&whole_seconds))
+        std::snprintf(buf, sizeof(buf), "%02d:%02d:%02d.%03d", utc->tm_hour, utc->tm_min, utc->tm_sec, milliseconds);
+    else
+        std::snprintf(buf, sizeof(buf), "%.3f s", time_seconds);
+    return buf;
+}
+
+void SignalsWindow::RenderCursors(const Subplot& subplot)
+{
+    const bool delta = cursor_mode_ == CursorMode::Delta;
+    double cursor_times[2] = {};
+    if (delta)
     {
-        const ImGuiPayload* active_payload = ImGui::GetDragDropPayload();
-        if (active_payload && active_payload->IsDataType(SIG_DND_TYPE) && s_sig_dnd_source && s_sig_dnd_source != this)
+        // cursors are anchored to the right edge so they stay in place while live data scrolls by
+        const double end_time = ImPlot::GetPlotLimits().X.Max;
+        const ImVec4 cursor_colors[2] = { ImVec4(1.0f, 0.8f, 0.2f, 1.0f), ImVec4(0.3f, 0.8f, 1.0f, 1.0f) };
+        for (int i = 0; i < 2; ++i)
         {
-            ImGuiWindow* window = ImGui::GetCurrentWindow();
-            if (ImGui::BeginDragDropTargetCustom(window->InnerRect, window->ID))
+            cursor_offsets_seconds_[i] = ImClamp(cursor_offsets_seconds_[i], 0.0, (double)seconds_shown_);
+            cursor_times[i] = end_time - cursor_offsets_seconds_[i];
+            if (ImPlot::DragLineX(i, &cursor_times[i], cursor_colors[i]))
+                cursor_offsets_seconds_[i] = end_time - cursor_times[i];
+        }
+    }
+    else
+    {
+        if (!ImPlot::IsPlotHovered())
+            return;
+        cursor_times[0] = ImPlot::GetPlotMousePos().x;
+        ImPlot::SetNextLineStyle(ImGui::GetStyle().Colors[ImGuiCol_Text]);
+        ImPlot::PlotInfLines("##Cursor", &cursor_times[0], 1);
+    }
+
+    if (!ImPlot::IsPlotHovered())
+        return;
+
+    ImGui::BeginTooltip();
+    if (delta)
+        ImGui::Text("A %s   B %s   dt %.6g s", FormatCursorTime(cursor_times[0]).c_str(), FormatCursorTime(cursor_times[1]).c_str(), cursor_times[1] - cursor_times[0]);
+    else
+        ImGui::Text("%s", FormatCursorTime(cursor_times[0]).c_str());
+
+    if (ImGui::BeginTable("##CursorReadout", 5, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Signal");
+        if (delta)
+        {
+            ImGui::TableSetupColumn("A");
+            ImGui::TableSetupColumn("B");
+            ImGui::TableSetupColumn("B - A");
+            ImGui::TableSetupColumn("Unit");
+        }
+        else
+        {
+            ImGui::TableSetupColumn("Avg");
+            ImGui::TableSetupColumn("Min");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableSetupColumn("Unit");
+        }
+        ImGui::TableHeadersRow();
+
+        for (const std::string& id : subplot.signal_ids)
+        {
+            auto it = signals_map_.find(id);
+            if (it == signals_map_.end())
+                continue;
+            const Signal& signal = it->second;
+            const OpenDAQSignal& to_read = is_paused_ ? signal.paused : *signal.live;
+            int index_a = to_read.FindPlotIndex(cursor_times[0]);
+            int index_b = delta ? to_read.FindPlotIndex(cursor_times[1]) : -1;
+            if (index_a < 0 && index_b < 0)
+                continue;
+
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextColored(signal.color, "%s", to_read.signal_name_.c_str());
+            if (delta)
             {
-                if (const ImGuiPayload* payload = ImGui::AcceptDragDropPayload(SIG_DND_TYPE))
+                ImGui::TableNextColumn(); RenderCursorValue(to_read.plot_values_avg_, index_a);
+                ImGui::TableNextColumn(); RenderCursorValue(to_read.plot_values_avg_, index_b);
+                ImGui::TableNextColumn();
+                if (index_a >= 0 && index_b >= 0)
+                    ImGui::Text("%.6g", to_read.plot_values_avg_[index_b] - to_read.plot_values_avg_[index_a]);
+                else
+                    ImGui::TextUnformatted(MISSING_CURSOR_VALUE);
+            }
+            else
+            {
+                ImGui::TableNextColumn(); RenderCursorValue(to_read.plot_values_avg_, index_a);
+                ImGui::TableNextColumn(); RenderCursorValue(to_read.plot_values_min_, index_a);
+                ImGui::TableNextColumn(); RenderCursorValue(to_read.plot_values_max_, index_a);
+            }
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(to_read.signal_unit_.c_str());
+        }
+        ImGui::EndTable();
+    }
+    ImGui::EndTooltip();
+}
+
+// Reduces the visible part of a signal's ring buffer to one min/max pair per pixel column.
+// Columns without any points are left at max/lowest so callers can skip them.
+static int BuildColumnEnvelope(const OpenDAQSignal& signal, double start_time, double duration, int columns,
+                               std::vector<float>& column_min, std::vector<float>& column_max)
+{
+    column_min.assign(columns, std::numeric_limits<float>::max());
+    column_max.assign(columns, std::numeric_limits<float>::lowest());
+
+    const size_t capacity = signal.plot_times_seconds_.size();
+    const size_t count = std::min(signal.points_in_plot_buffer_, capacity);
+    if (count == 0 || duration <= 0 || signal.plot_values_min_.size() != capacity || signal.plot_values_max_.size() != capacity)
+        return 0;
+
+    int filled_columns = 0;
+    const size_t first = (signal.pos_in_plot_buffer_ + capacity - count) % capacity;
+    const double columns_per_second = columns / duration;
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t idx = (first + i) % capacity;
+        int column = (int)((signal.plot_times_seconds_[idx] - start_time) * columns_per_second);
+        if (column < 0 || column >= columns)
+            continue;
+
+        if (column_min[column] > column_max[column])
+            filled_columns++;
+        column_min[column] = std::min(column_min[column], (float)signal.plot_values_min_[idx]);
+        column_max[column] = std::max(column_max[column], (float)signal.plot_values_max_[idx]);
+    }
+    return filled_columns;
+}
+
+void SignalsWindow::RenderOverview()
+{
+    std::vector<Signal*> strips;
+    strips.reserve(signals_map_.size());
+    double max_end_time = 0;
+    for (const Subplot& subplot : subplots_)
+    {
+        for (const std::string& id : subplot.signal_ids)
+        {
+            auto it = signals_map_.find(id);
+            if (it == signals_map_.end())
+                continue;
+            strips.push_back(&it->second);
+            max_end_time = std::max(max_end_time, (is_paused_ ? it->second.paused : *it->second.live).end_time_seconds_);
+        }
+    }
+    if (strips.empty())
+        return;
+
+    ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(ImGui::GetStyle().ItemSpacing.x, 1.0f));
+    if (ImGui::BeginChild("##Overview", ImVec2(-1, -1)))
+    {
+        // strips shrink to fit the window, down to a few pixels after which the child starts scrolling
+        const float min_strip_height = 3.0f;
+        const float max_strip_height = ImGui::GetFrameHeight() * 2.0f;
+        const float strip_height = ImClamp(ImGui::GetContentRegionAvail().y / (float)strips.size() - 1.0f, min_strip_height, max_strip_height);
+        const float label_width = ImMin(ImGui::GetFontSize() * 12.0f, ImGui::GetContentRegionAvail().x * 0.25f);
+        const bool draw_labels = strip_height >= ImGui::GetFontSize() * 0.8f;
+        const double start_time = max_end_time - seconds_shown_;
+
+        // everything is drawn as raw primitives into the child's draw list, so the whole overview ends up in a single draw command
+        ImDrawList* draw_list = ImGui::GetWindowDrawList();
+        const ImU32 background_color = ImGui::GetColorU32(ImGuiCol_FrameBg);
+        const ImU32 text_color = ImGui::GetColorU32(ImGuiCol_Text);
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)strips.size(), strip_height + 1.0f);
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                Signal& signal = *strips[i];
+                const OpenDAQSignal& to_plot = is_paused_ ? signal.paused : *signal.live;
+
+                ImVec2 strip_min = ImGui::GetCursorScreenPos();
+                float strip_width = ImGui::GetContentRegionAvail().x;
+                ImGui::Dummy(ImVec2(strip_width, strip_height));
+                bool hovered = ImGui::IsItemHovered();
+
+                ImRect plot_rect(ImVec2(strip_min.x + label_width, strip_min.y), ImVec2(strip_min.x + strip_width, strip_min.y + strip_height));
+                draw_list->AddRectFilled(plot_rect.Min, plot_rect.Max, background_color);
+                if (draw_labels)
                 {
-                    std::string signal_id = (const char*)payload->Data;
-                    SignalsWindow* source = s_sig_dnd_source;
-                    auto src_it = source->signals_map_.find(signal_id);
-                    if (src_it != source->signals_map_.end() && !signals_map_.count(signal_id))
-                    {
-                        auto& src_signal = src_it->second;
-                        signals_map_[signal_id] = { OpenDAQSignal(src_signal.live.signal_, seconds_shown_), OpenDAQSignal(), src_signal.color };
-                        if (subplots_.empty())
-                            subplots_.emplace_back();
-                        subplots_[0].signal_ids.push_back(signal_id);
-                    }
-                    if (source->is_cloned_)
-                    {
-                        source->signals_map_.erase(signal_id);
-                        for (auto& s : source->subplots_)
-                        {
-                            auto& ids = s.signal_ids;
-                            ids.erase(std::remove(ids.begin(), ids.end(), signal_id), ids.end());
-                        }
-                        source->subplots_.erase(std::remove_if(source->subplots_.begin(), source->subplots_.end(),
-                                                               [](const Subplot& s) { return s.signal_ids.empty(); }),
-                                                source->subplots_.end());
-                    }
-                    if (is_cloned_)
-                        freeze_selection_ = true;
+                    ImVec4 clip(strip_min.x, strip_min.y, plot_rect.Min.x - ImGui::GetStyle().ItemSpacing.x, plot_rect.Max.y);
+                    draw_list->AddRectFilled(ImVec2(strip_min.x, strip_min.y), ImVec2(strip_min.x + 3.0f, plot_rect.Max.y), ImGui::GetColorU32(signal.color));
+                    draw_list->AddText(ImGui::GetFont(), ImGui::GetFontSize(), ImVec2(strip_min.x + 6.0f, strip_min.y + (strip_height - ImGui::GetFontSize()) * 0.5f),
+                                       text_color, to_plot.signal_name_.c_str(), nullptr, 0.0f, &clip);
+                }
+
+                int columns = std::max(1, (int)plot_rect.GetWidth());
+                if (!to_plot.axes_.empty())
+                    continue; // multi-dimensional signals have no time history to summarize
+
+                int filled_columns = BuildColumnEnvelope(to_plot, start_time, seconds_shown_, columns, overview_column_min_, overview_column_max_);
+                if (filled_columns == 0)
+                    continue;
+
+                float range_min = to_plot.value_range_min_;
+                float range_max = to_plot.value_range_max_;
+                if (range_max <= range_min)
+                {
+                    range_min -= 1.0f;
+                    range_max += 1.0f;
+                }
+                const float y_scale = plot_rect.GetHeight() / (range_max - range_min);
+                const ImU32 envelope_color = ImGui::GetColorU32(signal.color);
+
+                draw_list->PrimReserve(filled_columns * 6, filled_columns * 4);
+                for (int column = 0; column < columns; ++column)
+                {
+                    if (overview_column_min_[column] > overview_column_max_[column])
+                        continue;
+                    float y_top = plot_rect.Max.y - (ImClamp(overview_column_max_[column], range_min, range_max) - range_min) * y_scale;
+                    float y_bottom = plot_rect.Max.y - (ImClamp(overview_column_min_[column], range_min, range_max) - range_min) * y_scale;
+                    if (y_bottom - y_top < 1.0f)
+                        y_bottom = y_top + 1.0f;
+                    float x = plot_rect.Min.x + (float)column;
+                    draw_list->PrimRect(ImVec2(x, y_top), ImVec2(x + 1.0f, y_bottom), envelope_color);
+                }
+
+                if (hovered && ImGui::GetMousePos().x >= plot_rect.Min.x)
+                {
+                    int column = ImClamp((int)(ImGui::GetMousePos().x - plot_rect.Min.x), 0, columns - 1);
+                    ImGui::BeginTooltip();
+                    ImGui::ColorButton("##SignalColor", signal.color, ImGuiColorEditFlags_NoTooltip | ImGuiColorEditFlags_NoDragDrop | ImGuiColorEditFlags_NoOptions, ImVec2(ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()));
+                    ImGui::SameLine();
+                    ImGui::Text("%s%s", to_plot.signal_name_.c_str(), to_plot.signal_unit_.empty() ? "" : (" [" + to_plot.signal_unit_ + "]").c_str());
+                    if (overview_column_min_[column] <= overview_column_max_[column])
+                        ImGui::Text("min %g, max %g", overview_column_min_[column], overview_column_max_[column]);
+                    ImGui::EndTooltip();
+                }
+                else if (hovered)
+                {
+                    ImGui::SetTooltip("%s", to_plot.signal_id_.c_str());
                 }
-                ImGui::EndDragDropTarget();
             }
         }
     }
+    ImGui::EndChild();
+    ImGui::PopStyleVar();
+}
 
-    ImGui::End();
+void SignalsWindow::RenderExport()
+{
+    std::string export_error;
+    if (exporter_.PollFinished(export_error))
+    {
+        if (export_error.empty())
+            ImGui::InsertNotification({ImGuiToastType::Success, DEFAULT_NOTIFICATION_DURATION_MS, "Exported signals to %s", exporter_.path_.c_str()});
+        else
+            ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Failed to export signals: %s", export_error.c_str()});
+    }
+
+    if (exporter_.IsRunning())
+    {
+        ImGui::ProgressBar(exporter_.Progress(), ImVec2(100, ImGui::GetFrameHeight()));
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Exporting to %s", exporter_.path_.c_str());
+        return;
+    }
+
+    ImGui::BeginDisabled(signals_map_.empty());
+    if (ImGui::Button(ICON_FA_FILE_EXPORT))
+        ImGui::OpenPopup("ExportSignals");
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip(is_paused_ ? "Export paused signal data" : "Export shown signal data");
+    ImGui::EndDisabled();
+
+    if (ImGui::BeginPopup("ExportSignals"))
+    {
+        auto set_format = [this](ExportFormat format, const char* extension)
+            {
+                export_format_ = format;
+                size_t dot = export_path_.find_last_of('.');
+                if (dot != std::string::npos && export_path_.find_first_of("/\\", dot) == std::string::npos)
+                    export_path_ = export_path_.substr(0, dot) + extension;
+            };
+        if (ImGui::RadioButton("CSV", export_format_ == ExportFormat::Csv))
+            set_format(ExportFormat::Csv, ".csv");
+        ImGui::SameLine();
+        if (ImGui::RadioButton("Binary", export_format_ == ExportFormat::Binary))
+            set_format(ExportFormat::Binary, ".bin");
+        ImGui::SetNextItemWidth(300);
+        ImGui::InputText("File", &export_path_);
+
+        ImGui::BeginDisabled(export_path_.empty());
+        if (ImGui::Button("Export"))
+        {
+            // only the copies are handed to the writer thread, so plotting keeps going while it runs
+            std::vector<SignalSnapshot> snapshots;
+            int skipped_multi_dim = 0;
+            for (const Subplot& subplot : subplots_)
+            {
+                for (const std::string& id : subplot.signal_ids)
+                {
+                    auto it = signals_map_.find(id);
+                    if (it == signals_map_.end())
+                        continue;
+                    const OpenDAQSignal& signal = is_paused_ ? it->second.paused : *it->second.live;
+                    if (!signal.axes_.empty())
+                        skipped_multi_dim++;
+                    else
+                        snapshots.push_back(TakeSnapshot(signal));
+                }
+            }
+            if (snapshots.empty())
+            {
+                ImGui::InsertNotification({ImGuiToastType::Error, DEFAULT_NOTIFICATION_DURATION_MS, "Nothing to export, multi-dimensional signals are not supported"});
+            }
+            else
+            {
+                if (skipped_multi_dim > 0)
+                    ImGui::InsertNotification({ImGuiToastType::Warning, DEFAULT_NOTIFICATION_DURATION_MS, "Skipped %d multi-dimensional signal(s), exporting them is not supported", skipped_multi_dim});
+                exporter_.Start(std::move(snapshots), export_path_, export_format_);
+            }
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::EndDisabled();
+        ImGui::EndPopup();
+    }
+}
+
+void SignalsWindow::SyncSpectrumAnalyzers()
+{
+    std::unordered_map<std::string, const Subplot*> spectrum_subplot_by_signal;
+    for (const Subplot& subplot : subplots_)
+    {
+        if (subplot.type != SubplotType::Spectrum)
+            continue;
+        for (const std::string& id : subplot.signal_ids)
+            spectrum_subplot_by_signal[id] = &subplot;
+    }
+
+    for (auto& [id, signal] : signals_map_)
+    {
+        auto it = spectrum_subplot_by_signal.find(id);
+        bool wants_spectrum = it != spectrum_subplot_by_signal.end()
+                           && signal.live->axes_.empty()
+                           && signal.live->signal_type_ == SignalType::DomainAndValue;
+        if (!wants_spectrum)
+        {
+            signal.spectrum.reset();
+            continue;
+        }
+
+        if (!signal.spectrum)
+            signal.spectrum = std::make_shared<SpectrumAnalyzer>();
+        if (!signal.spectrum->subscription_ || !signal.live->HasRawSampleSubscription(signal.spectrum->subscription_))
+        {
+            // the live signal may be shared with and outlive this window, so only hold on to the analyzer weakly
+            std::weak_ptr<SpectrumAnalyzer> weak_analyzer = signal.spectrum;
+            signal.spectrum->subscription_ = signal.live->SubscribeRawSamples([weak_analyzer](const double* values, size_t count)
+                {
+                    if (std::shared_ptr<SpectrumAnalyzer> analyzer = weak_analyzer.lock())
+                        analyzer->PushSamples(values, count);
+                });
+        }
+        signal.spectrum->Configure(it->second->spectrum_config, signal.live->samples_per_second_);
+    }
+}
+
+void SignalsWindow::UpdateAutoFitLimits(Subplot& subplot, double data_min, double data_max)
+{
+    double padding = (data_max - data_min) * 0.05;
+    if (padding <= 0)
+        padding = std::max(std::abs(data_max) * 0.05, 1e-6); // flat signal
+    const double target_min = data_min - padding;
+    const double target_max = data_max + padding;
+    if (!subplot.fit_y_valid)
+    {
+        subplot.fit_y_min = target_min;
+        subplot.fit_y_max = target_max;
+        subplot.fit_y_valid = true;
+        return;
+    }
+
+    // grow immediately so nothing gets clipped, but shrink gradually so the axis does not jitter
+    const double shrink = 1.0 - std::exp(-ImGui::GetIO().DeltaTime / AUTO_FIT_SHRINK_SECONDS);
+    subplot.fit_y_min = target_min < subplot.fit_y_min ? target_min : subplot.fit_y_min + (target_min - subplot.fit_y_min) * shrink;
+    subplot.fit_y_max = target_max > subplot.fit_y_max ? target_max : subplot.fit_y_max + (target_max - subplot.fit_y_max) * shrink;
+}
+
+void SignalsWindow::RenderSubplotOptions(Subplot& subplot, ImVec2 plot_top_right)
+{
+    ImGui::PushID(subplot.uid);
+    const float padding = ImGui::GetStyle().FramePadding.x;
+    const float button_width = ImGui::CalcTextSize(ICON_FA_GEAR).x + ImGui::GetStyle().FramePadding.x * 2.0f;
+    ImGui::SetCursorScreenPos(ImVec2(plot_top_right.x - button_width - padding, plot_top_right.y + padding));
+    if (ImGui::SmallButton(ICON_FA_GEAR))
+        ImGui::OpenPopup("SubplotOptions");
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Subplot options");
+
+    if (ImGui::BeginPopup("SubplotOptions"))
+    {
+        if (ImGui::RadioButton("Time", subplot.type == SubplotType::Time))
+            subplot.type = SubplotType::Time;
+        ImGui::SameLine();
+        if (ImGui::RadioButton("Spectrum", subplot.type == SubplotType::Spectrum))
+            subplot.type = SubplotType::Spectrum;
+
+        if (subplot.type == SubplotType::Time)
+            ImGui::Checkbox("Auto-fit Y axis to visible data", &subplot.auto_fit_y);
+
+        if (subplot.type == SubplotType::Spectrum)
+        {
+            SpectrumAnalyzer::Config& config = subplot.spectrum_config;
+            ImGui::SetNextItemWidth(150);
+            if (ImGui::BeginCombo("FFT size", std::to_string(config.fft_size).c_str()))
+            {
+                for (int size = 256; size <= 65536; size *= 2)
+                {
+                    if (ImGui::Selectable(std::to_string(size).c_str(), size == config.fft_size))
+                        config.fft_size = size;
+                }
+                ImGui::EndCombo();
+            }
+            float overlap_percent = config.overlap * 100.0f;
+            ImGui::SetNextItemWidth(150);
+            if (ImGui::SliderFloat("Overlap", &overlap_percent, 0.0f, 95.0f, "%.0f %%"))
+                config.overlap = overlap_percent / 100.0f;
+            ImGui::SetNextItemWidth(150);
+            ImGui::SliderInt("Averages", &config.averages, 1, 64);
+        }
+        ImGui::EndPopup();
+    }
+    ImGui::PopID();
 }
 
 void SignalsWindow::RebuildInvalidSignals()
 {
     for (auto& [id, sig] : signals_map_)
-        sig.live.RebuildIfInvalid();
+        sig.live->RebuildIfInvalid();
 
     total_min_ = std::numeric_limits<float>::max();
     total_max_ = std::numeric_limits<float>::lowest();
     for (auto& [_, signal] : signals_map_)
     {
-        total_min_ = std::min(total_min_, signal.live.value_range_min_);
-        total_max_ = std::max(total_max_, signal.live.value_range_max_);
+        total_min_ = std::min(total_min_, signal.live->value_range_min_);
+        total_max_ = std::max(total_max_, signal.live->value_range_max_);
     }
 }
 
@@ -6,12 +6,28 @@
 #include <memory>
 #include "component_cache.h"
 #include "signal.h"
+#include "spectrum_analyzer.h"
+#include "signal_export.h"
 
 struct Signal
 {
-    OpenDAQSignal live;
+    std::shared_ptr<OpenDAQSignal> live = std::make_shared<OpenDAQSignal>(); // shared between windows showing the same signal (clones, drag and drop)
     OpenDAQSignal paused;
     ImVec4 color;
+    std::shared_ptr<SpectrumAnalyzer> spectrum; // only set while the signal is shown in a spectrum subplot
+};
+
+enum class CursorMode
+{
+    Off,
+    Single,
+    Delta
+};
+
+enum class SubplotType
+{
+    Time,
+    Spectrum
 };
 
 class SignalsWindow
@@ -30,27 +46,46 @@ public:
     std::function<void(const std::vector<std::string>&)> on_reselect_click_;
     bool is_open_ = true;
 
+    // an export still being written when the window goes away is handed to the owner, so closing never waits on it
+    bool IsExporting() const { return exporter_.IsRunning(); }
+    SignalExporter TakeExport() { return std::move(exporter_); }
+
     void SaveSettings(ImGuiTextBuffer* buf)
     {
         buf->appendf("SecondsShown=%f\n", seconds_shown_);
+        buf->appendf("OverviewMode=%d\n", overview_mode_);
     }
 
     void LoadSettings(const char* line)
     {
         float f;
+        int i;
         if (sscanf(line, "SecondsShown=%f", &f) == 1) seconds_shown_ = f;
+        else if (sscanf(line, "OverviewMode=%d", &i) == 1) overview_mode_ = (bool)i;
     }
 
     std::vector<std::string> selected_component_ids_;
     bool freeze_selection_ = false;
     bool is_cloned_ = false;
     float seconds_shown_ = 5.0f;
+    bool overview_mode_ = false;
     int clone_id_ = 0;
 
 private:
+    void SyncSpectrumAnalyzers();
+    void RenderSubplots();
+    void RenderOverview();
+    void RenderExport();
+
     struct Subplot {
         std::vector<std::string> signal_ids;
         int uid;
+        SubplotType type = SubplotType::Time;
+        SpectrumAnalyzer::Config spectrum_config;
+        bool auto_fit_y = false;
+        bool fit_y_valid = false;
+        double fit_y_min = 0.0;
+        double fit_y_max = 1.0;
 
         Subplot(std::vector<std::string> ids = {}) : signal_ids(std::move(ids)) {
             static int next_uid = 0;
@@ -58,10 +93,25 @@ private:
         }
     };
 
+    void RenderSubplotOptions(Subplot& subplot, ImVec2 plot_top_right);
+    void RenderCursors(const Subplot& subplot);
+    void UpdateAutoFitLimits(Subplot& subplot, double data_min, double data_max);
+
     bool is_paused_ = false;
     std::unordered_map<std::string, Signal> signals_map_;
     std::vector<Subplot> subplots_;
     float total_min_ = 0.0f;
     float total_max_ = 0.0f;
     int plot_unique_id_ = 0; // id used to reset plot (especially min/max axis) whenever inputs change
+
+    // scratch buffers for the overview strips, reused between frames
+    std::vector<float> overview_column_min_;
+    std::vector<float> overview_column_max_;
+
+    CursorMode cursor_mode_ = CursorMode::Off;
+    double cursor_offsets_seconds_[2] = { 0.0, 0.0 }; // delta cursors, in seconds before the right edge of the plot
+
+    SignalExporter exporter_;
+    std::string export_path_ = "signals.csv";
+    ExportFormat export_format_ = ExportFormat::Csv;
 };
@@ -0,0 +1,289 @@
+#include "spectrum_analyzer.h"
+#include <algorithm>
+#include <cmath>
+
+
+static constexpr double PI = 3.14159265358979323846;
+static constexpr double MIN_MAGNITUDE_DB = -200.0;
+// how many FFT frames worth of samples the worker may lag behind before old samples are dropped
+static constexpr std::size_t MAX_BACKLOG_FRAMES = 16;
+
+
+AlignedBuffer SpectrumBufferPool::Acquire(std::size_t size)
+{
+    for (auto it = free_buffers_.begin(); it != free_buffers_.end(); ++it)
+    {
+        if (it->size() == size)
+        {
+            AlignedBuffer buffer = std::move(*it);
+            free_buffers_.erase(it);
+            return buffer;
+        }
+    }
+    return AlignedBuffer(size);
+}
+
+void SpectrumBufferPool::Release(AlignedBuffer&& buffer)
+{
+    if (buffer.size() > 0)
+        free_buffers_.push_back(std::move(buffer));
+}
+
+SpectrumAnalyzer::SpectrumAnalyzer()
+{
+    worker_ = std::thread([this]() { WorkerLoop(); });
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    {
+        std::lock_guard<std::mutex> lock(input_mutex_);
+        stop_ = true;
+    }
+    input_cv_.notify_one();
+    worker_.join();
+}
+
+void SpectrumAnalyzer::Configure(const Config& config, double sample_rate)
+{
+    if (config == config_ && sample_rate == sample_rate_)
+        return;
+
+    config_ = config;
+    sample_rate_ = sample_rate;
+    {
+        std::lock_guard<std::mutex> lock(input_mutex_);
+        pending_config_ = config;
+        pending_sample_rate_ = sample_rate;
+        pending_samples_.clear();
+        config_dirty_ = true;
+    }
+    input_cv_.notify_one();
+}
+
+void SpectrumAnalyzer::PushSamples(const double* values, std::size_t count)
+{
+    if (count == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(input_mutex_);
+        // a busy or stalled worker would otherwise let the queue grow without bound
+        const std::size_t max_pending = (std::size_t)pending_config_.fft_size * MAX_BACKLOG_FRAMES;
+        if (count >= max_pending)
+        {
+            pending_samples_.assign(values + (count - max_pending), values + count);
+        }
+        else
+        {
+            pending_samples_.insert(pending_samples_.end(), values, values + count);
+            if (pending_samples_.size() > max_pending)
+                pending_samples_.erase(pending_samples_.begin(), pending_samples_.begin() + (std::ptrdiff_t)(pending_samples_.size() - max_pending));
+        }
+    }
+    input_cv_.notify_one();
+}
+
+bool SpectrumAnalyzer::PollResult()
+{
+    std::lock_guard<std::mutex> lock(result_mutex_);
+    if (published_generation_ == polled_generation_)
+        return false;
+
+    polled_generation_ = published_generation_;
+    magnitudes_db_.assign(published_magnitudes_db_.begin(), published_magnitudes_db_.end());
+    frequencies_.resize(magnitudes_db_.size());
+    for (std::size_t i = 0; i < frequencies_.size(); ++i)
+        frequencies_[i] = (double)i * published_bin_hz_;
+    return true;
+}
+
+void SpectrumAnalyzer::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(input_mutex_);
+    while (true)
+    {
+        input_cv_.wait(lock, [this]() { return stop_ || config_dirty_ || !pending_samples_.empty(); });
+        if (stop_)
+            return;
+
+        if (config_dirty_)
+        {
+            Config config = pending_config_;
+            double sample_rate = pending_sample_rate_;
+            config_dirty_ = false;
+            lock.unlock();
+            Rebuild(config, sample_rate);
+            lock.lock();
+            continue;
+        }
+
+        incoming_.swap(pending_samples_);
+        lock.unlock();
+
+        history_.insert(history_.end(), incoming_.begin(), incoming_.end());
+        incoming_.clear();
+
+        const std::size_t fft_size = (std::size_t)worker_config_.fft_size;
+        const std::size_t hop = std::max<std::size_t>(1, (std::size_t)std::lround(fft_size * (1.0 - worker_config_.overlap)));
+
+        std::size_t available = history_.size() - history_offset_;
+        if (available > fft_size * MAX_BACKLOG_FRAMES)
+            history_offset_ = history_.size() - fft_size * MAX_BACKLOG_FRAMES;
+
+        bool processed_any = false;
+        while (history_.size() - history_offset_ >= fft_size)
+        {
+            ProcessFrame(history_.data() + history_offset_);
+            history_offset_ += hop;
+            processed_any = true;
+        }
+        if (history_offset_ > 0 && history_offset_ >= history_.size() / 2)
+        {
+            history_offset_ = std::min(history_offset_, history_.size());
+            history_.erase(history_.begin(), history_.begin() + (std::ptrdiff_t)history_offset_);
+            history_offset_ = 0;
+        }
+
+        if (processed_any)
+            Publish();
+
+        lock.lock();
+    }
+}
+
+void SpectrumAnalyzer::Rebuild(const Config& config, double sample_rate)
+{
+    worker_config_ = config;
+    int fft_size = 16;
+    while (fft_size < config.fft_size && fft_size < (1 << 20))
+        fft_size <<= 1;
+    worker_config_.fft_size = fft_size; // radix-2 only
+    worker_config_.overlap = std::clamp(config.overlap, 0.0f, 0.95f);
+    worker_config_.averages = std::max(1, config.averages);
+    worker_sample_rate_ = sample_rate;
+
+    history_.clear();
+    history_offset_ = 0;
+    for (AlignedBuffer& buffer : recent_magnitudes_)
+        pool_.Release(std::move(buffer));
+    recent_magnitudes_.clear();
+
+    const std::size_t n = (std::size_t)worker_config_.fft_size;
+    const std::size_t bins = n / 2 + 1;
+    if (window_.size() != n)
+    {
+        // the pool only ever holds buffers of the previous bin count, so drop them along with the old size
+        pool_.Clear();
+        window_ = AlignedBuffer(n);
+        twiddle_cos_ = AlignedBuffer(n / 2);
+        twiddle_sin_ = AlignedBuffer(n / 2);
+        real_ = AlignedBuffer(n);
+        imag_ = AlignedBuffer(n);
+        magnitude_sum_ = AlignedBuffer(bins);
+
+        window_gain_ = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            window_[i] = 0.5 - 0.5 * std::cos(2.0 * PI * (double)i / (double)n); // Hann
+            window_gain_ += window_[i];
+        }
+        for (std::size_t k = 0; k < n / 2; ++k)
+        {
+            twiddle_cos_[k] = std::cos(2.0 * PI * (double)k / (double)n);
+            twiddle_sin_[k] = std::sin(2.0 * PI * (double)k / (double)n);
+        }
+
+        int bits = 0;
+        while (((std::size_t)1 << bits) < n)
+            bits++;
+        bit_reversed_.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            uint32_t reversed = 0;
+            for (int b = 0; b < bits; ++b)
+                if (i & ((std::size_t)1 << b))
+                    reversed |= 1u << (bits - 1 - b);
+            bit_reversed_[i] = reversed;
+        }
+    }
+    std::fill(magnitude_sum_.data(), magnitude_sum_.data() + bins, 0.0);
+
+    std::lock_guard<std::mutex> lock(result_mutex_);
+    published_magnitudes_db_.clear();
+    published_bin_hz_ = 0;
+    published_generation_++;
+}
+
+void SpectrumAnalyzer::ProcessFrame(const double* frame)
+{
+    const std::size_t n = window_.size();
+    const std::size_t bins = n / 2 + 1;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        std::size_t j = bit_reversed_[i];
+        real_[j] = frame[i] * window_[i];
+        imag_[j] = 0.0;
+    }
+
+    // iterative radix-2 Cooley-Tukey
+    for (std::size_t len = 2; len <= n; len <<= 1)
+    {
+        const std::size_t half = len / 2;
+        const std::size_t step = n / len;
+        for (std::size_t start = 0; start < n; start += len)
+        {
+            for (std::size_t k = 0; k < half; ++k)
+            {
+                const double wr = twiddle_cos_[k * step];
+                const double wi = -twiddle_sin_[k * step];
+                const std::size_t a = start + k;
+                const std::size_t b = a + half;
+                const double vr = real_[b] * wr - imag_[b] * wi;
+                const double vi = real_[b] * wi + imag_[b] * wr;
+                real_[b] = real_[a] - vr;
+                imag_[b] = imag_[a] - vi;
+                real_[a] += vr;
+                imag_[a] += vi;
+            }
+        }
+    }
+
+    AlignedBuffer magnitudes = pool_.Acquire(bins);
+    const double scale = 2.0 / window_gain_;
+    for (std::size_t k = 0; k < bins; ++k)
+    {
+        double amplitude = std::sqrt(real_[k] * real_[k] + imag_[k] * imag_[k]) * scale;
+        if (k == 0 || k == n / 2)
+            amplitude *= 0.5;
+        magnitudes[k] = amplitude;
+        magnitude_sum_[k] += amplitude;
+    }
+    recent_magnitudes_.push_back(std::move(magnitudes));
+
+    while (recent_magnitudes_.size() > (std::size_t)worker_config_.averages)
+    {
+        AlignedBuffer& oldest = recent_magnitudes_.front();
+        for (std::size_t k = 0; k < bins; ++k)
+            magnitude_sum_[k] -= oldest[k];
+        pool_.Release(std::move(oldest));
+        recent_magnitudes_.pop_front();
+    }
+}
+
+void SpectrumAnalyzer::Publish()
+{
+    const std::size_t bins = magnitude_sum_.size();
+    const double count = (double)std::max<std::size_t>(1, recent_magnitudes_.size());
+
+    std::lock_guard<std::mutex> lock(result_mutex_);
+    published_magnitudes_db_.resize(bins);
+    for (std::size_t k = 0; k < bins; ++k)
+    {
+        double amplitude = std::max(0.0, magnitude_sum_[k] / count);
+        published_magnitudes_db_[k] = amplitude > 0 ? std::max(MIN_MAGNITUDE_DB, 20.0 * std::log10(amplitude)) : MIN_MAGNITUDE_DB;
+    }
+    published_bin_hz_ = worker_sample_rate_ / (double)window_.size();
+    published_generation_++;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
+
+
+// Fixed-size block of doubles aligned to a cache line, recycled through SpectrumBufferPool
+struct AlignedBuffer
+{
+    static constexpr std::size_t ALIGNMENT = 64;
+
+    struct Deleter
+    {
+        void operator()(double* ptr) const { ::operator delete[](ptr, std::align_val_t(ALIGNMENT)); }
+    };
+
+    AlignedBuffer() = default;
+    explicit AlignedBuffer(std::size_t size)
+        : data_(static_cast<double*>(::operator new[](size * sizeof(double), std::align_val_t(ALIGNMENT))))
+        , size_(size)
+    {
+    }
+
+    double* data() { return data_.get(); }
+    const double* data() const { return data_.get(); }
+    std::size_t size() const { return size_; }
+    double& operator[](std::size_t i) { return data_[i]; }
+    const double& operator[](std::size_t i) const { return data_[i]; }
+
+private:
+    std::unique_ptr<double[], Deleter> data_;
+    std::size_t size_ = 0;
+};
+
+class SpectrumBufferPool
+{
+public:
+    AlignedBuffer Acquire(std::size_t size);
+    void Release(AlignedBuffer&& buffer);
+    void Clear() { free_buffers_.clear(); }
+
+private:
+    std::vector<AlignedBuffer> free_buffers_;
+};
+
+// Computes a windowed, averaged amplitude spectrum of a sample stream on its own worker thread.
+// PushSamples/Configure/PollResult are called from the UI thread, everything else runs on the worker.
+class SpectrumAnalyzer
+{
+public:
+    struct Config
+    {
+        int fft_size = 4096;
+        float overlap = 0.5f;
+        int averages = 4;
+
+        bool operator==(const Config& other) const { return fft_size == other.fft_size && overlap == other.overlap && averages == other.averages; }
+        bool operator!=(const Config& other) const { return !(*this == other); }
+    };
+
+    SpectrumAnalyzer();
+    ~SpectrumAnalyzer();
+    SpectrumAnalyzer(const SpectrumAnalyzer&) = delete;
+    SpectrumAnalyzer& operator=(const SpectrumAnalyzer&) = delete;
+
+    void Configure(const Config& config, double sample_rate);
+    void PushSamples(const double* values, std::size_t count);
+    // Copies the latest published spectrum into frequencies_/magnitudes_db_, returns true if it changed
+    bool PollResult();
+
+    std::vector<double> frequencies_;
+    std::vector<double> magnitudes_db_;
+    // token of the sample stream feeding the analyzer, dropping it unsubscribes
+    std::shared_ptr<void> subscription_;
+
+private:
+    void WorkerLoop();
+    void Rebuild(const Config& config, double sample_rate);
+    void ProcessFrame(const double* frame);
+    void Publish();
+
+    std::thread worker_;
+    std::mutex input_mutex_;
+    std::condition_variable input_cv_;
+    std::vector<double> pending_samples_;
+    Config pending_config_;
+    double pending_sample_rate_ = 0;
+    bool config_dirty_ = true;
+    bool stop_ = false;
+
+    // UI thread view of the configuration, used to skip redundant Configure calls
+    Config config_;
+    double sample_rate_ = 0;
+
+    // worker-only state
+    Config worker_config_;
+    double worker_sample_rate_ = 0;
+    std::vector<double> incoming_;
+    std::vector<double> history_;
+    std::size_t history_offset_ = 0;
+    SpectrumBufferPool pool_;
+    AlignedBuffer window_;
+    AlignedBuffer twiddle_cos_;
+    AlignedBuffer twiddle_sin_;
+    AlignedBuffer real_;
+    AlignedBuffer imag_;
+    AlignedBuffer magnitude_sum_;
+    std::vector<uint32_t> bit_reversed_;
+    std::deque<AlignedBuffer> recent_magnitudes_;
+    double window_gain_ = 1;
+
+    std::mutex result_mutex_;
+    std::vector<double> published_magnitudes_db_;
+    double published_bin_hz_ = 0;
+    uint64_t published_generation_ = 0;
+    uint64_t polled_generation_ = 0;
+};
@@ -4,33 +4,59 @@
 #include "utils.h"
 #include "IconsFontAwesome6.h"
 #include <string>
+#include <algorithm>
 
 
 void TreeViewWindow::OnSelectionChanged(const std::vector<std::string>& selected_ids, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& /*all_components*/)
 {
-    selected_component_guids_.clear();
+    for (ComponentHandle handle : selected_handles_)
+        is_selected_.Set(handle, false);
+    selected_handles_.clear();
     for (const auto& id : selected_ids)
-        selected_component_guids_.insert(id);
+        SetSelected(InternComponentId(id), true);
 }
 
-void TreeViewWindow::Render(const CachedComponent* root, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components)
+void TreeViewWindow::SetSelected(ComponentHandle handle, bool selected)
+{
+    if (is_selected_[handle] == selected)
+        return;
+
+    is_selected_.Set(handle, selected);
+    if (selected)
+        selected_handles_.push_back(handle);
+    else
+        selected_handles_.erase(std::remove(selected_handles_.begin(), selected_handles_.end(), handle), selected_handles_.end());
+}
+
+void TreeViewWindow::NotifySelectionChanged()
+{
+    if (!on_selection_changed_callback_)
+        return;
+
+    std::vector<std::string> selected;
+    selected.reserve(selected_handles_.size());
+    for (ComponentHandle handle : selected_handles_)
+        selected.push_back(ComponentIdOf(handle));
+    on_selection_changed_callback_(selected);
+}
+
+void TreeViewWindow::Render(const CachedComponent* root, const ComponentsByHandle& components)
 {
     ImGui::Begin("Tree", nullptr);
     if (ImSearch::BeginSearch())
     {
         ImSearch::SearchBar();
         if (root)
-            RenderTreeNode(root, all_components);
+            RenderTreeNode(root, components);
         ImSearch::EndSearch();
     }
     assert(pending_expansion_states_.empty());
     ImGui::End();
 }
 
-void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components, const CachedComponent* parent)
+void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const ComponentsByHandle& components, const CachedComponent* parent)
 {
-    std::string name = component->name_;
-    std::string component_guid = component->component_.getGlobalId().toStdString();
+    const std::string& name = component->name_;
     bool has_children = !component->children_.empty();
 
     if (has_children)
@@ -43,21 +69,21 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
             // skip the nested "FB" folder for function blocks, just make sure to properly propagate expansion state to immediate children
             bool propagate_state = false;
             bool expand = false;
-            if (auto it = pending_expansion_states_.find(component_guid); it != pending_expansion_states_.end())
+            if (auto it = pending_expansion_states_.find(component->handle_); it != pending_expansion_states_.end())
             {
                 propagate_state = true;
                 expand = it->second;
                 pending_expansion_states_.erase(it);
             }
 
-            for (const auto& child_id : component->children_)
+            for (ComponentHandle child_handle : component->children_)
             {
-                if (auto it = all_components.find(child_id.id_); it != all_components.end())
+                if (const CachedComponent* child = components[child_handle])
                 {
-                    if (propagate_state && !it->second->children_.empty())
-                        pending_expansion_states_[child_id.id_] = expand;
+                    if (propagate_state && !child->children_.empty())
+                        pending_expansion_states_[child_handle] = expand;
 
-                    RenderTreeNode(it->second.get(), all_components, component);
+                    RenderTreeNode(child, components, component);
                 }
             }
             return;
@@ -65,7 +91,7 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
     }
     
     ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_SpanFullWidth | ImGuiTreeNodeFlags_DrawLinesToNodes;
-    if (selected_component_guids_.find(component_guid) != selected_component_guids_.end())
+    if (is_selected_[component->handle_])
         flags |= ImGuiTreeNodeFlags_Selected;
 
     if (has_children)
@@ -73,10 +99,11 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
     else
         flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
     
-    auto render_node_logic = [this, component, &all_components, component_guid, flags, has_children](const char* label) -> bool {
+    auto render_node_logic = [this, component, &components, flags, has_children](const char* label) -> bool {
+        const std::string& component_guid = component->uid_;
         if (has_children)
         {
-            if (auto it = pending_expansion_states_.find(component_guid); it != pending_expansion_states_.end())
+            if (auto it = pending_expansion_states_.find(component->handle_); it != pending_expansion_states_.end())
             {
                 ImGui::SetNextItemOpen(it->second, ImGuiCond_Always);
                 pending_expansion_states_.erase(it);
@@ -133,13 +160,10 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
                 expand_or_collapse_triggered = ExpandCollapseOption::Expand;
             if (expand_or_collapse_triggered != ExpandCollapseOption::None)
             {
-                for (const auto& child_id : component->children_)
+                for (ComponentHandle child_handle : component->children_)
                 {
-                    if (auto it = all_components.find(child_id.id_); it != all_components.end())
-                    {
-                        if (!it->second->children_.empty())
-                            pending_expansion_states_[child_id.id_] = (expand_or_collapse_triggered == ExpandCollapseOption::Expand);
-                    }
+                    if (const CachedComponent* child = components[child_handle]; child && !child->children_.empty())
+                        pending_expansion_states_[child_handle] = (expand_or_collapse_triggered == ExpandCollapseOption::Expand);
                 }
             }
 
@@ -147,12 +171,8 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
 
             if (ImGui::MenuItem("Select all children"))
             {
-                SelectChildrenRecursive(component, all_components);
-                if (on_selection_changed_callback_)
-                {
-                    std::vector<std::string> selected(selected_component_guids_.begin(), selected_component_guids_.end());
-                    on_selection_changed_callback_(selected);
-                }
+                SelectChildrenRecursive(component, components);
+                NotifySelectionChanged();
             }
 
             ImGui::EndPopup();
@@ -165,7 +185,7 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
         }
 
         if (!ImGui::IsItemToggledOpen())
-            CheckTreeNodeClicked(component_guid);
+            CheckTreeNodeClicked(component->handle_);
 
         return open;
     };
@@ -175,10 +195,10 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
         bool node_open = ImSearch::PushSearchable(name.c_str(), render_node_logic);
         if (node_open)
         {
-            for (const auto& child_id : component->children_)
+            for (ComponentHandle child_handle : component->children_)
             {
-                if (auto it = all_components.find(child_id.id_); it != all_components.end())
-                    RenderTreeNode(it->second.get(), all_components, component);
+                if (const CachedComponent* child = components[child_handle])
+                    RenderTreeNode(child, components, component);
             }
             ImSearch::PopSearchable([](){ ImGui::TreePop(); });
         }
@@ -189,39 +209,34 @@ void TreeViewWindow::RenderTreeNode(const CachedComponent* component, const std:
     }
 }
 
-void TreeViewWindow::SelectChildrenRecursive(const CachedComponent* component, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components)
+void TreeViewWindow::SelectChildrenRecursive(const CachedComponent* component, const ComponentsByHandle& components)
 {
-    for (const auto& child_id : component->children_)
+    for (ComponentHandle child_handle : component->children_)
     {
-        if (auto it = all_components.find(child_id.id_); it != all_components.end())
+        if (const CachedComponent* child = components[child_handle])
         {
-            selected_component_guids_.insert(child_id.id_);
-            SelectChildrenRecursive(it->second.get(), all_components);
+            SetSelected(child_handle, true);
+            SelectChildrenRecursive(child, components);
         }
     }
 }
 
-void TreeViewWindow::CheckTreeNodeClicked(const std::string& component_guid)
+void TreeViewWindow::CheckTreeNodeClicked(ComponentHandle handle)
 {
     if (!ImGui::IsItemClicked())
         return;
 
     if (ImGui::GetIO().KeyCtrl)
     {
-        if (selected_component_guids_.count(component_guid))
-            selected_component_guids_.erase(component_guid);
-        else
-            selected_component_guids_.insert(component_guid);
+        SetSelected(handle, !is_selected_[handle]);
     }
     else
     {
-        selected_component_guids_.clear();
-        selected_component_guids_.insert(component_guid);
+        for (ComponentHandle selected : selected_handles_)
+            is_selected_.Set(selected, false);
+        selected_handles_.clear();
+        SetSelected(handle, true);
     }
 
-    if (on_selection_changed_callback_)
-    {
-        std::vector<std::string> selected(selected_component_guids_.begin(), selected_component_guids_.end());
-        on_selection_changed_callback_(selected);
-    }
+    NotifySelectionChanged();
 }
@@ -3,14 +3,13 @@
 #include "component_cache.h"
 #include <vector>
 #include <string>
-#include <unordered_set>
 #include <unordered_map>
 #include <memory>
 
 class TreeViewWindow
 {
 public:
-    void Render(const CachedComponent* root, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components);
+    void Render(const CachedComponent* root, const ComponentsByHandle& components);
     void OnSelectionChanged(const std::vector<std::string>& selected_ids, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components);
 
     std::function<void(const std::vector<std::string>&)> on_selection_changed_callback_;
@@ -18,11 +17,14 @@ public:
 
 private:
     void RenderTreeNode(const CachedComponent* component,
-                        const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components,
+                        const ComponentsByHandle& components,
                         const CachedComponent* parent = nullptr);
-    void SelectChildrenRecursive(const CachedComponent* component, const std::unordered_map<std::string, std::unique_ptr<CachedComponent>>& all_components);
-    void CheckTreeNodeClicked(const std::string& component_guid);
+    void SelectChildrenRecursive(const CachedComponent* component, const ComponentsByHandle& components);
+    void CheckTreeNodeClicked(ComponentHandle handle);
+    void SetSelected(ComponentHandle handle, bool selected);
+    void NotifySelectionChanged();
 
-    std::unordered_set<std::string> selected_component_guids_;
-    std::unordered_map<std::string, bool> pending_expansion_states_;
+    std::vector<ComponentHandle> selected_handles_; // in selection order
+    ComponentHandleMap<bool> is_selected_;
+    std::unordered_map<ComponentHandle, bool> pending_expansion_states_;
 };
@@ -7,6 +7,12 @@ const int DEFAULT_NOTIFICATION_DURATION_MS = 10'000;
 const ImVec4 COLOR_ERROR = ImVec4(1.0f, 0.3f, 0.3f, 1.0f);
 const ImVec4 COLOR_WARNING = ImVec4(1.0f, 0.7f, 0.2f, 1.0f);
 
+// Global IDs are paths, so a component's descendants are exactly the IDs below its own
+inline bool IsInSubtree(const std::string& id, const std::string& root_id)
+{
+    return id.compare(0, root_id.size(), root_id) == 0 && (id.size() == root_id.size() || id[root_id.size()] == '/');
+}
+
 // utility functions for working with OpenDAQ objects
 template <class Interface>
 inline bool canCastTo(daq::IBaseObject* baseObject)